@@ -0,0 +1,107 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <unistd.h>
+#include "mprpcapplication.h"
+#include "rpcadmission.h"
+#include "rpcscheduler.h"
+#include "rpctracer.h"
+
+// 线程池饱和时的准入控制压测，不经过网络：按provider有工作线程时的路径，
+// 入队前只占并发名额(TryAcquire)，工作线程出队时按排队延迟做CoDel判断(Overloaded)。
+// 请求以-r给出的速率到达，每个请求占用工作线程-s微秒，到达速率超过-t*1000000/-s时线程池饱和。
+// 配置文件中设置admission_target_ms时应当看到被拒绝的请求和有界的排队延迟，不设置时排队延迟持续增长
+struct BenchState
+{
+    std::atomic<uint64_t> completed{0};
+    std::atomic<uint64_t> shed{0};
+    std::mutex mutex;
+    std::vector<int64_t> delays; // 执行了的请求的排队延迟
+};
+
+int main(int argc, char **argv)
+{
+    std::string config_file;
+    int threads = 4;
+    int service_us = 1000;
+    int rate = 8000;
+    int seconds = 5;
+    int opt;
+    while ((opt = getopt(argc, argv, "i:t:s:r:d:")) != -1) {
+        switch (opt) {
+            case 'i': config_file = optarg; break;
+            case 't': threads = atoi(optarg); break;
+            case 's': service_us = atoi(optarg); break;
+            case 'r': rate = atoi(optarg); break;
+            case 'd': seconds = atoi(optarg); break;
+            default:
+                std::cerr << "Usage: " << argv[0] << " -i <config_file> [-t threads] [-s service_us] [-r requests_per_second] [-d seconds]"
+                          << std::endl;
+                return 1;
+        }
+    }
+    if (config_file.empty() || rate <= 0) {
+        std::cerr << "Config file must be specified with -i option" << std::endl;
+        return 1;
+    }
+    MprpcApplication::InitFromConfig(config_file);
+
+    RpcAdmissionController admission;
+    admission.Init();
+    RpcScheduler scheduler;
+    RpcScheduler::MethodQueue *queue = scheduler.AddMethod("Bench.Call", 0, RPC_PRIORITY_DEFAULT);
+    scheduler.Start(threads);
+
+    BenchState state;
+    uint64_t submitted = 0;
+    uint64_t rejected = 0;
+    int64_t interval_us = 1000000 / rate;
+    int64_t begin_us = RpcTracer::NowMicros();
+    int64_t end_us = begin_us + seconds * 1000000LL;
+    for (int64_t next_us = begin_us; next_us < end_us; next_us += interval_us) {
+        int64_t now_us = RpcTracer::NowMicros();
+        if (next_us > now_us) {
+            std::this_thread::sleep_for(std::chrono::microseconds(next_us - now_us));
+        }
+        int64_t receive_us = RpcTracer::NowMicros();
+        submitted++;
+        if (!admission.TryAcquire()) {
+            rejected++;
+            continue;
+        }
+        scheduler.Submit(queue, [&, receive_us]() {
+            int64_t now_us = RpcTracer::NowMicros();
+            if (admission.Overloaded(now_us - receive_us, now_us, RPC_PRIORITY_DEFAULT)) {
+                state.shed++;
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(service_us));
+                state.completed++;
+                std::lock_guard<std::mutex> lock(state.mutex);
+                state.delays.push_back(now_us - receive_us);
+            }
+            scheduler.Finish(queue);
+            admission.Release();
+        });
+    }
+    int running = 0;
+    size_t queued = 0;
+    scheduler.Stats(&running, &queued);
+    scheduler.Stop();
+
+    std::vector<int64_t> &delays = state.delays;
+    std::sort(delays.begin(), delays.end());
+    auto percentile = [&delays](double p) -> int64_t {
+        return delays.empty() ? 0 : delays[static_cast<size_t>(p * (delays.size() - 1))];
+    };
+    std::cout << "threads:" << threads << " service us:" << service_us << " rate:" << rate
+              << " capacity:" << threads * 1000000LL / std::max(service_us, 1) << "/s" << std::endl;
+    std::cout << "submitted:" << submitted << " completed:" << state.completed << " shed at dequeue:" << state.shed
+              << " rejected at enqueue:" << rejected << " still queued:" << queued << std::endl;
+    std::cout << "queue delay us p50:" << percentile(0.5) << " p99:" << percentile(0.99)
+              << " max:" << percentile(1.0) << std::endl;
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <unistd.h>
+#include "mprpcapplication.h"
+#include "friend.pb.h"
+
+// 建连速率压测：mprpc每次调用都新建一条连接，多线程不停发起调用即可压出provider的accept能力。
+// 配置文件中把nginxip/nginxport直接指向provider，分别在rpc_reuseport=false/true下运行对比，
+// 再逐步增加-t线程数观察吞吐是否随核数增长。
+int main(int argc, char **argv)
+{
+    std::string config_file;
+    int threads = 8;
+    int seconds = 10;
+    int opt;
+    while ((opt = getopt(argc, argv, "i:t:d:")) != -1) {
+        switch (opt) {
+            case 'i': config_file = optarg; break;
+            case 't': threads = atoi(optarg); break;
+            case 'd': seconds = atoi(optarg); break;
+            default:
+                std::cerr << "Usage: " << argv[0] << " -i <config_file> [-t threads] [-d seconds]" << std::endl;
+                return 1;
+        }
+    }
+    if (config_file.empty()) {
+        std::cerr << "Config file must be specified with -i option" << std::endl;
+        return 1;
+    }
+    MprpcApplication::InitFromConfig(config_file);
+
+    std::atomic<bool> stop{false};
+    std::vector<std::vector<int64_t>> latencies(threads);
+    std::vector<uint64_t> failures(threads, 0);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back([&, i]() {
+            fixbug::FriendServiceRpc_Stub stub(new MprpcChannel());
+            fixbug::GetFriendListRequest req;
+            req.set_userid(i);
+            while (!stop) {
+                fixbug::GetFriendListResponse res;
+                MprpcController controller;
+                auto begin = std::chrono::steady_clock::now();
+                stub.GetFriendList(&controller, &req, &res, nullptr);
+                auto end = std::chrono::steady_clock::now();
+                if (controller.Failed()) {
+                    failures[i]++;
+                } else {
+                    latencies[i].push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop = true;
+    for (std::thread &t : workers) {
+        t.join();
+    }
+
+    std::vector<int64_t> all;
+    uint64_t failed = 0;
+    for (int i = 0; i < threads; i++) {
+        all.insert(all.end(), latencies[i].begin(), latencies[i].end());
+        failed += failures[i];
+    }
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all](double p) -> int64_t {
+        return all.empty() ? 0 : all[static_cast<size_t>(p * (all.size() - 1))];
+    };
+
+    std::cout << "threads:" << threads << " seconds:" << seconds << std::endl;
+    std::cout << "connections:" << all.size() << " failed:" << failed << std::endl;
+    std::cout << "conn/s:" << all.size() / seconds << std::endl;
+    std::cout << "latency us p50:" << percentile(0.5) << " p99:" << percentile(0.99)
+              << " max:" << percentile(1.0) << std::endl;
+    return 0;
+}
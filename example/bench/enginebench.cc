@@ -0,0 +1,138 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "mprpcapplication.h"
+#include "friend.pb.h"
+
+// 不同传输和io引擎的对比压测，配置文件中的nginxip/nginxport直接指向provider。
+// 客户端按-e给出的传输依次各跑一轮(默认tcp,uring)，输出吞吐、延迟和每次调用消耗的客户端CPU时间。
+// 服务端的对比：provider分别以rpc_io_engine=muduo和rpc_io_engine=uring启动，各跑一次本程序；
+// 要比较shm传输时provider需要配置rpc_shm_path。
+struct PhaseResult
+{
+    uint64_t calls;
+    uint64_t failed;
+    int64_t p50;
+    int64_t p99;
+    int64_t max;
+    double cpu_us_per_call;
+};
+
+static int64_t CpuMicros()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000LL + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+static PhaseResult RunPhase(const std::string &transport, int threads, int seconds)
+{
+    std::atomic<bool> stop{false};
+    std::vector<std::vector<int64_t>> latencies(threads);
+    std::vector<uint64_t> failures(threads, 0);
+    std::vector<std::thread> workers;
+    int64_t cpu_begin = CpuMicros();
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back([&, i]() {
+            MprpcChannel *channel = new MprpcChannel();
+            channel->SetTransport(transport);
+            fixbug::FriendServiceRpc_Stub stub(channel, google::protobuf::Service::STUB_OWNS_CHANNEL);
+            fixbug::GetFriendListRequest req;
+            req.set_userid(i);
+            while (!stop) {
+                fixbug::GetFriendListResponse res;
+                MprpcController controller;
+                auto begin = std::chrono::steady_clock::now();
+                stub.GetFriendList(&controller, &req, &res, nullptr);
+                auto end = std::chrono::steady_clock::now();
+                if (controller.Failed()) {
+                    failures[i]++;
+                } else {
+                    latencies[i].push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop = true;
+    for (std::thread &t : workers) {
+        t.join();
+    }
+    int64_t cpu_used = CpuMicros() - cpu_begin;
+
+    std::vector<int64_t> all;
+    PhaseResult result = {0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < threads; i++) {
+        all.insert(all.end(), latencies[i].begin(), latencies[i].end());
+        result.failed += failures[i];
+    }
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all](double p) -> int64_t {
+        return all.empty() ? 0 : all[static_cast<size_t>(p * (all.size() - 1))];
+    };
+    result.calls = all.size();
+    result.p50 = percentile(0.5);
+    result.p99 = percentile(0.99);
+    result.max = percentile(1.0);
+    result.cpu_us_per_call = result.calls > 0 ? static_cast<double>(cpu_used) / result.calls : 0;
+    return result;
+}
+
+static void Print(const std::string &name, const PhaseResult &r, int seconds)
+{
+    std::cout << name << " calls:" << r.calls << " failed:" << r.failed << " qps:" << r.calls / seconds
+              << " latency us p50:" << r.p50 << " p99:" << r.p99 << " max:" << r.max
+              << " cpu us/call:" << r.cpu_us_per_call << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    std::string config_file;
+    int threads = 8;
+    int seconds = 10;
+    std::string transports = "tcp,uring";
+    int opt;
+    while ((opt = getopt(argc, argv, "i:t:d:e:")) != -1) {
+        switch (opt) {
+            case 'i': config_file = optarg; break;
+            case 'e': transports = optarg; break;
+            case 't': threads = atoi(optarg); break;
+            case 'd': seconds = atoi(optarg); break;
+            default:
+                std::cerr << "Usage: " << argv[0] << " -i <config_file> [-t threads] [-d seconds] [-e tcp,uring,shm]" << std::endl;
+                return 1;
+        }
+    }
+    if (config_file.empty()) {
+        std::cerr << "Config file must be specified with -i option" << std::endl;
+        return 1;
+    }
+    MprpcApplication::InitFromConfig(config_file);
+
+    std::cout << "threads:" << threads << " seconds:" << seconds << std::endl;
+    uint64_t baseline = 0;
+    for (size_t begin = 0; begin < transports.size();) {
+        size_t end = transports.find(',', begin);
+        end = end == std::string::npos ? transports.size() : end;
+        std::string name = transports.substr(begin, end - begin);
+        begin = end + 1;
+        if (!RpcTransportRegistry::GetInstance().GetClient(name)) {
+            std::cerr << "unknown transport " << name << std::endl;
+            continue;
+        }
+        PhaseResult result = RunPhase(name, threads, seconds);
+        Print(name, result, seconds);
+        if (baseline == 0) {
+            baseline = result.calls;
+        } else {
+            std::cout << "  throughput vs first:" << static_cast<double>(result.calls) / baseline << std::endl;
+        }
+    }
+    return 0;
+}
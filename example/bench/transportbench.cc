@@ -0,0 +1,111 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <unistd.h>
+#include "mprpcapplication.h"
+#include "friend.pb.h"
+
+// unix域socket和回环TCP的对比压测：provider配置rpc_unix_path，并和压测进程运行在同一台机器上，
+// 配置文件中的nginxip/nginxport直接指向provider，zookeeper中能查到provider登记的unix路径。
+// 先用TCP跑一轮，再让客户端优先走unix socket跑一轮，分别输出吞吐和延迟。
+struct PhaseResult
+{
+    uint64_t calls;
+    uint64_t failed;
+    int64_t p50;
+    int64_t p99;
+    int64_t max;
+};
+
+static PhaseResult RunPhase(bool prefer_unix, int threads, int seconds)
+{
+    std::atomic<bool> stop{false};
+    std::vector<std::vector<int64_t>> latencies(threads);
+    std::vector<uint64_t> failures(threads, 0);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back([&, i]() {
+            MprpcChannel *channel = new MprpcChannel();
+            channel->SetPreferUnix(prefer_unix);
+            fixbug::FriendServiceRpc_Stub stub(channel, google::protobuf::Service::STUB_OWNS_CHANNEL);
+            fixbug::GetFriendListRequest req;
+            req.set_userid(i);
+            while (!stop) {
+                fixbug::GetFriendListResponse res;
+                MprpcController controller;
+                auto begin = std::chrono::steady_clock::now();
+                stub.GetFriendList(&controller, &req, &res, nullptr);
+                auto end = std::chrono::steady_clock::now();
+                if (controller.Failed()) {
+                    failures[i]++;
+                } else {
+                    latencies[i].push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop = true;
+    for (std::thread &t : workers) {
+        t.join();
+    }
+
+    std::vector<int64_t> all;
+    PhaseResult result = {0, 0, 0, 0, 0};
+    for (int i = 0; i < threads; i++) {
+        all.insert(all.end(), latencies[i].begin(), latencies[i].end());
+        result.failed += failures[i];
+    }
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all](double p) -> int64_t {
+        return all.empty() ? 0 : all[static_cast<size_t>(p * (all.size() - 1))];
+    };
+    result.calls = all.size();
+    result.p50 = percentile(0.5);
+    result.p99 = percentile(0.99);
+    result.max = percentile(1.0);
+    return result;
+}
+
+static void Print(const char *name, const PhaseResult &r, int seconds)
+{
+    std::cout << name << " calls:" << r.calls << " failed:" << r.failed << " qps:" << r.calls / seconds
+              << " latency us p50:" << r.p50 << " p99:" << r.p99 << " max:" << r.max << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    std::string config_file;
+    int threads = 8;
+    int seconds = 10;
+    int opt;
+    while ((opt = getopt(argc, argv, "i:t:d:")) != -1) {
+        switch (opt) {
+            case 'i': config_file = optarg; break;
+            case 't': threads = atoi(optarg); break;
+            case 'd': seconds = atoi(optarg); break;
+            default:
+                std::cerr << "Usage: " << argv[0] << " -i <config_file> [-t threads] [-d seconds]" << std::endl;
+                return 1;
+        }
+    }
+    if (config_file.empty()) {
+        std::cerr << "Config file must be specified with -i option" << std::endl;
+        return 1;
+    }
+    MprpcApplication::InitFromConfig(config_file);
+
+    std::cout << "threads:" << threads << " seconds:" << seconds << std::endl;
+    PhaseResult tcp = RunPhase(false, threads, seconds);
+    Print("tcp ", tcp, seconds);
+    PhaseResult unix_socket = RunPhase(true, threads, seconds);
+    Print("unix", unix_socket, seconds);
+    if (tcp.calls > 0) {
+        std::cout << "unix/tcp throughput:" << static_cast<double>(unix_socket.calls) / tcp.calls << std::endl;
+    }
+    return 0;
+}
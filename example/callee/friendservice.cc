@@ -7,6 +7,7 @@
 #include "friend.pb.h"
 #include "mprpcapplication.h"
 #include "rpcprovider.h"
+#include "rpcstream.h"
 #include "nginxconfigupdater.h"
 
 class FriendService : public fixbug::FriendServiceRpc
@@ -50,6 +51,70 @@ public:
         done->Run();
     }
 
+    // 流式返回好友列表：每写出一条就可以释放它，provider端最多缓存调用方授予配额的条数
+    void StreamFriendList(::google::protobuf::RpcController* controller,
+                          const ::fixbug::GetFriendListRequest* request,
+                          ::fixbug::FriendEntry* response,
+                          ::google::protobuf::Closure* done) override
+    {
+        LogRequest("StreamFriendList RPC");
+
+        RpcServerStream *stream = RpcServerStream::FromController(controller);
+        std::vector<std::string> vec = GetFriendList(request->userid());
+        for (std::string &name : vec) {
+            fixbug::FriendEntry entry;
+            entry.set_name(name);
+            if (!stream->Write(entry)) {
+                // 调用方已经断开，不再继续
+                break;
+            }
+        }
+        done->Run();
+    }
+
+    // 调用方流：逐条读取上传的好友，调用方半关闭后返回结果
+    void AddFriends(::google::protobuf::RpcController* controller,
+                    const ::fixbug::FriendEntry* request,
+                    ::fixbug::ResultCode* response,
+                    ::google::protobuf::Closure* done) override
+    {
+        LogRequest("AddFriends RPC");
+
+        RpcServerStream *stream = RpcServerStream::FromController(controller);
+        fixbug::FriendEntry entry;
+        int count = 0;
+        while (stream->Read(&entry)) {
+            count++;
+        }
+        std::cout << "导入好友数: " << count << std::endl;
+        response->set_errcode(0);
+        response->set_errmsg("");
+        done->Run();
+    }
+
+    // 双向流：每读到一个用户id就写回他的好友
+    void LookupFriends(::google::protobuf::RpcController* controller,
+                       const ::fixbug::GetFriendListRequest* request,
+                       ::fixbug::FriendEntry* response,
+                       ::google::protobuf::Closure* done) override
+    {
+        LogRequest("LookupFriends RPC");
+
+        RpcServerStream *stream = RpcServerStream::FromController(controller);
+        fixbug::GetFriendListRequest lookup;
+        while (stream->Read(&lookup)) {
+            for (std::string &name : GetFriendList(lookup.userid())) {
+                fixbug::FriendEntry entry;
+                entry.set_name(name);
+                if (!stream->Write(entry)) {
+                    done->Run();
+                    return;
+                }
+            }
+        }
+        done->Run();
+    }
+
 private:
     int port_;  // 服务端口
     
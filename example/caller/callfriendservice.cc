@@ -2,6 +2,9 @@
 #include "mprpcapplication.h"
 #include "friend.pb.h"
 #include "logger.h"
+#include "rpcstream.h"
+#include "mprpcstreamchannel.h"
+#include <thread>
 #include <unistd.h>
 #include "nginxconfigupdater.h"
 
@@ -62,4 +65,69 @@ int main(int argc, char **argv)
             std::cout << "rpc GetFriend response error:" << res.result().errmsg() << std::endl;
         }
     }
+
+    // 流式调用：每收到一个好友回调一次，CallMethod在流结束后返回
+    int index = 0;
+    RpcStreamController streamController([&index](const google::protobuf::Message &message) {
+        const fixbug::FriendEntry &entry = static_cast<const fixbug::FriendEntry &>(message);
+        std::cout << "stream index" << ++index << " friend name:" << entry.name() << std::endl;
+        return true;
+    });
+    fixbug::FriendEntry entry;
+    stub.StreamFriendList(&streamController, &req, &entry, nullptr);
+    if (streamController.Failed())
+    {
+        std::cout << "rpc StreamFriendList error:" << streamController.ErrorText() << std::endl;
+    }
+
+    // 调用方流和双向流共用一条多路复用的连接
+    MprpcStreamChannel streamChannel;
+    if (!streamChannel.Connect())
+    {
+        std::cout << "stream channel connect error" << std::endl;
+        return 1;
+    }
+    const google::protobuf::ServiceDescriptor *sd = fixbug::FriendServiceRpc::descriptor();
+
+    std::shared_ptr<MprpcClientStream> upload = streamChannel.OpenStream(sd->FindMethodByName("AddFriends"));
+    for (int i = 0; i < 100; i++)
+    {
+        fixbug::FriendEntry friendEntry;
+        friendEntry.set_name("friend" + std::to_string(i));
+        if (!upload->Write(friendEntry))
+        {
+            break;
+        }
+    }
+    upload->WritesDone();
+    fixbug::ResultCode result;
+    if (upload->Finish(&result) == 0)
+    {
+        std::cout << "rpc AddFriends errcode:" << result.errcode() << std::endl;
+    }
+    else
+    {
+        std::cout << "rpc AddFriends error:" << upload->ErrorText() << std::endl;
+    }
+
+    std::shared_ptr<MprpcClientStream> lookup = streamChannel.OpenStream(sd->FindMethodByName("LookupFriends"));
+    std::thread writer([lookup]() {
+        for (uint32_t userid = 1; userid <= 3; userid++)
+        {
+            fixbug::GetFriendListRequest lookupReq;
+            lookupReq.set_userid(userid);
+            lookup->Write(lookupReq);
+        }
+        lookup->WritesDone();
+    });
+    fixbug::FriendEntry lookupEntry;
+    while (lookup->Read(&lookupEntry))
+    {
+        std::cout << "lookup friend name:" << lookupEntry.name() << std::endl;
+    }
+    writer.join();
+    if (lookup->Finish() != 0)
+    {
+        std::cout << "rpc LookupFriends error:" << lookup->ErrorText() << std::endl;
+    }
 }
\ No newline at end of file
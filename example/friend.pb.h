@@ -1,103 +1,117 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: friend.proto
 
-#ifndef PROTOBUF_INCLUDED_friend_2eproto
-#define PROTOBUF_INCLUDED_friend_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_friend_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_friend_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_friend_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_friend_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_friend_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[3];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_friend_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_friend_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_friend_2eproto;
 namespace fixbug {
+class FriendEntry;
+struct FriendEntryDefaultTypeInternal;
+extern FriendEntryDefaultTypeInternal _FriendEntry_default_instance_;
 class GetFriendListRequest;
-class GetFriendListRequestDefaultTypeInternal;
+struct GetFriendListRequestDefaultTypeInternal;
 extern GetFriendListRequestDefaultTypeInternal _GetFriendListRequest_default_instance_;
 class GetFriendListResponse;
-class GetFriendListResponseDefaultTypeInternal;
+struct GetFriendListResponseDefaultTypeInternal;
 extern GetFriendListResponseDefaultTypeInternal _GetFriendListResponse_default_instance_;
 class ResultCode;
-class ResultCodeDefaultTypeInternal;
+struct ResultCodeDefaultTypeInternal;
 extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
 }  // namespace fixbug
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::fixbug::FriendEntry* Arena::CreateMaybeMessage<::fixbug::FriendEntry>(Arena*);
 template<> ::fixbug::GetFriendListRequest* Arena::CreateMaybeMessage<::fixbug::GetFriendListRequest>(Arena*);
 template<> ::fixbug::GetFriendListResponse* Arena::CreateMaybeMessage<::fixbug::GetFriendListResponse>(Arena*);
 template<> ::fixbug::ResultCode* Arena::CreateMaybeMessage<::fixbug::ResultCode>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace fixbug {
 
 // ===================================================================
 
-class ResultCode : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.ResultCode) */ {
+class ResultCode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.ResultCode) */ {
  public:
-  ResultCode();
-  virtual ~ResultCode();
+  inline ResultCode() : ResultCode(nullptr) {}
+  ~ResultCode() override;
+  explicit PROTOBUF_CONSTEXPR ResultCode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ResultCode(const ResultCode& from);
-
-  inline ResultCode& operator=(const ResultCode& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ResultCode(ResultCode&& from) noexcept
     : ResultCode() {
     *this = ::std::move(from);
   }
 
+  inline ResultCode& operator=(const ResultCode& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ResultCode& operator=(ResultCode&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ResultCode& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResultCode& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ResultCode* internal_default_instance() {
     return reinterpret_cast<const ResultCode*>(
                &_ResultCode_default_instance_);
@@ -105,117 +119,163 @@ class ResultCode : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(ResultCode* other);
   friend void swap(ResultCode& a, ResultCode& b) {
     a.Swap(&b);
   }
+  inline void Swap(ResultCode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResultCode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ResultCode* New() const final {
-    return CreateMaybeMessage<ResultCode>(NULL);
-  }
-
-  ResultCode* New(::google::protobuf::Arena* arena) const final {
+  ResultCode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ResultCode>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResultCode& from);
-  void MergeFrom(const ResultCode& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResultCode& from) {
+    ResultCode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResultCode* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.ResultCode";
   }
+  protected:
+  explicit ResultCode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrmsgFieldNumber = 2,
+    kErrcodeFieldNumber = 1,
+  };
   // bytes errmsg = 2;
   void clear_errmsg();
-  static const int kErrmsgFieldNumber = 2;
-  const ::std::string& errmsg() const;
-  void set_errmsg(const ::std::string& value);
-  #if LANG_CXX11
-  void set_errmsg(::std::string&& value);
-  #endif
-  void set_errmsg(const char* value);
-  void set_errmsg(const void* value, size_t size);
-  ::std::string* mutable_errmsg();
-  ::std::string* release_errmsg();
-  void set_allocated_errmsg(::std::string* errmsg);
+  const std::string& errmsg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_errmsg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_errmsg();
+  PROTOBUF_NODISCARD std::string* release_errmsg();
+  void set_allocated_errmsg(std::string* errmsg);
+  private:
+  const std::string& _internal_errmsg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_errmsg(const std::string& value);
+  std::string* _internal_mutable_errmsg();
+  public:
 
   // int32 errcode = 1;
   void clear_errcode();
-  static const int kErrcodeFieldNumber = 1;
-  ::google::protobuf::int32 errcode() const;
-  void set_errcode(::google::protobuf::int32 value);
+  int32_t errcode() const;
+  void set_errcode(int32_t value);
+  private:
+  int32_t _internal_errcode() const;
+  void _internal_set_errcode(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:fixbug.ResultCode)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr errmsg_;
-  ::google::protobuf::int32 errcode_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_friend_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
+    int32_t errcode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_friend_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetFriendListRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.GetFriendListRequest) */ {
+class GetFriendListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.GetFriendListRequest) */ {
  public:
-  GetFriendListRequest();
-  virtual ~GetFriendListRequest();
+  inline GetFriendListRequest() : GetFriendListRequest(nullptr) {}
+  ~GetFriendListRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetFriendListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetFriendListRequest(const GetFriendListRequest& from);
-
-  inline GetFriendListRequest& operator=(const GetFriendListRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GetFriendListRequest(GetFriendListRequest&& from) noexcept
     : GetFriendListRequest() {
     *this = ::std::move(from);
   }
 
+  inline GetFriendListRequest& operator=(const GetFriendListRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GetFriendListRequest& operator=(GetFriendListRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetFriendListRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetFriendListRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GetFriendListRequest* internal_default_instance() {
     return reinterpret_cast<const GetFriendListRequest*>(
                &_GetFriendListRequest_default_instance_);
@@ -223,102 +283,147 @@ class GetFriendListRequest : public ::google::protobuf::Message /* @@protoc_inse
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(GetFriendListRequest* other);
   friend void swap(GetFriendListRequest& a, GetFriendListRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(GetFriendListRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetFriendListRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetFriendListRequest* New() const final {
-    return CreateMaybeMessage<GetFriendListRequest>(NULL);
-  }
-
-  GetFriendListRequest* New(::google::protobuf::Arena* arena) const final {
+  GetFriendListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetFriendListRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetFriendListRequest& from);
-  void MergeFrom(const GetFriendListRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetFriendListRequest& from) {
+    GetFriendListRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetFriendListRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.GetFriendListRequest";
   }
+  protected:
+  explicit GetFriendListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUseridFieldNumber = 1,
+  };
   // uint32 userid = 1;
   void clear_userid();
-  static const int kUseridFieldNumber = 1;
-  ::google::protobuf::uint32 userid() const;
-  void set_userid(::google::protobuf::uint32 value);
+  uint32_t userid() const;
+  void set_userid(uint32_t value);
+  private:
+  uint32_t _internal_userid() const;
+  void _internal_set_userid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:fixbug.GetFriendListRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 userid_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_friend_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t userid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_friend_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetFriendListResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.GetFriendListResponse) */ {
+class GetFriendListResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.GetFriendListResponse) */ {
  public:
-  GetFriendListResponse();
-  virtual ~GetFriendListResponse();
+  inline GetFriendListResponse() : GetFriendListResponse(nullptr) {}
+  ~GetFriendListResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetFriendListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetFriendListResponse(const GetFriendListResponse& from);
-
-  inline GetFriendListResponse& operator=(const GetFriendListResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GetFriendListResponse(GetFriendListResponse&& from) noexcept
     : GetFriendListResponse() {
     *this = ::std::move(from);
   }
 
+  inline GetFriendListResponse& operator=(const GetFriendListResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GetFriendListResponse& operator=(GetFriendListResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GetFriendListResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetFriendListResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GetFriendListResponse* internal_default_instance() {
     return reinterpret_cast<const GetFriendListResponse*>(
                &_GetFriendListResponse_default_instance_);
@@ -326,104 +431,295 @@ class GetFriendListResponse : public ::google::protobuf::Message /* @@protoc_ins
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(GetFriendListResponse* other);
   friend void swap(GetFriendListResponse& a, GetFriendListResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(GetFriendListResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetFriendListResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GetFriendListResponse* New() const final {
-    return CreateMaybeMessage<GetFriendListResponse>(NULL);
-  }
-
-  GetFriendListResponse* New(::google::protobuf::Arena* arena) const final {
+  GetFriendListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetFriendListResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetFriendListResponse& from);
-  void MergeFrom(const GetFriendListResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetFriendListResponse& from) {
+    GetFriendListResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetFriendListResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.GetFriendListResponse";
   }
+  protected:
+  explicit GetFriendListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFriendsFieldNumber = 2,
+    kResultFieldNumber = 1,
+  };
   // repeated bytes friends = 2;
   int friends_size() const;
+  private:
+  int _internal_friends_size() const;
+  public:
   void clear_friends();
-  static const int kFriendsFieldNumber = 2;
-  const ::std::string& friends(int index) const;
-  ::std::string* mutable_friends(int index);
-  void set_friends(int index, const ::std::string& value);
-  #if LANG_CXX11
-  void set_friends(int index, ::std::string&& value);
-  #endif
+  const std::string& friends(int index) const;
+  std::string* mutable_friends(int index);
+  void set_friends(int index, const std::string& value);
+  void set_friends(int index, std::string&& value);
   void set_friends(int index, const char* value);
   void set_friends(int index, const void* value, size_t size);
-  ::std::string* add_friends();
-  void add_friends(const ::std::string& value);
-  #if LANG_CXX11
-  void add_friends(::std::string&& value);
-  #endif
+  std::string* add_friends();
+  void add_friends(const std::string& value);
+  void add_friends(std::string&& value);
   void add_friends(const char* value);
   void add_friends(const void* value, size_t size);
-  const ::google::protobuf::RepeatedPtrField< ::std::string>& friends() const;
-  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_friends();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& friends() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_friends();
+  private:
+  const std::string& _internal_friends(int index) const;
+  std::string* _internal_add_friends();
+  public:
 
   // .fixbug.ResultCode result = 1;
   bool has_result() const;
-  void clear_result();
-  static const int kResultFieldNumber = 1;
   private:
-  const ::fixbug::ResultCode& _internal_result() const;
+  bool _internal_has_result() const;
   public:
+  void clear_result();
   const ::fixbug::ResultCode& result() const;
-  ::fixbug::ResultCode* release_result();
+  PROTOBUF_NODISCARD ::fixbug::ResultCode* release_result();
   ::fixbug::ResultCode* mutable_result();
   void set_allocated_result(::fixbug::ResultCode* result);
+  private:
+  const ::fixbug::ResultCode& _internal_result() const;
+  ::fixbug::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::fixbug::ResultCode* result);
+  ::fixbug::ResultCode* unsafe_arena_release_result();
 
   // @@protoc_insertion_point(class_scope:fixbug.GetFriendListResponse)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> friends_;
+    ::fixbug::ResultCode* result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_friend_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FriendEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.FriendEntry) */ {
+ public:
+  inline FriendEntry() : FriendEntry(nullptr) {}
+  ~FriendEntry() override;
+  explicit PROTOBUF_CONSTEXPR FriendEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FriendEntry(const FriendEntry& from);
+  FriendEntry(FriendEntry&& from) noexcept
+    : FriendEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline FriendEntry& operator=(const FriendEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FriendEntry& operator=(FriendEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FriendEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FriendEntry* internal_default_instance() {
+    return reinterpret_cast<const FriendEntry*>(
+               &_FriendEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(FriendEntry& a, FriendEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FriendEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FriendEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FriendEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FriendEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FriendEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FriendEntry& from) {
+    FriendEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::std::string> friends_;
-  ::fixbug::ResultCode* result_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_friend_2eproto::TableStruct;
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FriendEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.FriendEntry";
+  }
+  protected:
+  explicit FriendEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+  };
+  // bytes name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fixbug.FriendEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_friend_2eproto;
 };
 // ===================================================================
 
 class FriendServiceRpc_Stub;
 
-class FriendServiceRpc : public ::google::protobuf::Service {
+class FriendServiceRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
  protected:
   // This class should be treated as an abstract interface.
   inline FriendServiceRpc() {};
@@ -432,25 +728,37 @@ class FriendServiceRpc : public ::google::protobuf::Service {
 
   typedef FriendServiceRpc_Stub Stub;
 
-  static const ::google::protobuf::ServiceDescriptor* descriptor();
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
 
-  virtual void GetFriendList(::google::protobuf::RpcController* controller,
+  virtual void GetFriendList(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::fixbug::GetFriendListRequest* request,
                        ::fixbug::GetFriendListResponse* response,
                        ::google::protobuf::Closure* done);
+  virtual void StreamFriendList(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::fixbug::GetFriendListRequest* request,
+                       ::fixbug::FriendEntry* response,
+                       ::google::protobuf::Closure* done);
+  virtual void AddFriends(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::fixbug::FriendEntry* request,
+                       ::fixbug::ResultCode* response,
+                       ::google::protobuf::Closure* done);
+  virtual void LookupFriends(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::fixbug::GetFriendListRequest* request,
+                       ::fixbug::FriendEntry* response,
+                       ::google::protobuf::Closure* done);
 
   // implements Service ----------------------------------------------
 
-  const ::google::protobuf::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                  ::google::protobuf::RpcController* controller,
-                  const ::google::protobuf::Message* request,
-                  ::google::protobuf::Message* response,
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
                   ::google::protobuf::Closure* done);
-  const ::google::protobuf::Message& GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
-  const ::google::protobuf::Message& GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
 
  private:
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FriendServiceRpc);
@@ -458,21 +766,33 @@ class FriendServiceRpc : public ::google::protobuf::Service {
 
 class FriendServiceRpc_Stub : public FriendServiceRpc {
  public:
-  FriendServiceRpc_Stub(::google::protobuf::RpcChannel* channel);
-  FriendServiceRpc_Stub(::google::protobuf::RpcChannel* channel,
-                   ::google::protobuf::Service::ChannelOwnership ownership);
+  FriendServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  FriendServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
   ~FriendServiceRpc_Stub();
 
-  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
 
   // implements FriendServiceRpc ------------------------------------------
 
-  void GetFriendList(::google::protobuf::RpcController* controller,
+  void GetFriendList(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::fixbug::GetFriendListRequest* request,
                        ::fixbug::GetFriendListResponse* response,
                        ::google::protobuf::Closure* done);
+  void StreamFriendList(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::fixbug::GetFriendListRequest* request,
+                       ::fixbug::FriendEntry* response,
+                       ::google::protobuf::Closure* done);
+  void AddFriends(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::fixbug::FriendEntry* request,
+                       ::fixbug::ResultCode* response,
+                       ::google::protobuf::Closure* done);
+  void LookupFriends(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::fixbug::GetFriendListRequest* request,
+                       ::fixbug::FriendEntry* response,
+                       ::google::protobuf::Closure* done);
  private:
-  ::google::protobuf::RpcChannel* channel_;
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
   bool owns_channel_;
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FriendServiceRpc_Stub);
 };
@@ -491,68 +811,71 @@ class FriendServiceRpc_Stub : public FriendServiceRpc {
 
 // int32 errcode = 1;
 inline void ResultCode::clear_errcode() {
-  errcode_ = 0;
+  _impl_.errcode_ = 0;
+}
+inline int32_t ResultCode::_internal_errcode() const {
+  return _impl_.errcode_;
 }
-inline ::google::protobuf::int32 ResultCode::errcode() const {
+inline int32_t ResultCode::errcode() const {
   // @@protoc_insertion_point(field_get:fixbug.ResultCode.errcode)
-  return errcode_;
+  return _internal_errcode();
 }
-inline void ResultCode::set_errcode(::google::protobuf::int32 value) {
+inline void ResultCode::_internal_set_errcode(int32_t value) {
   
-  errcode_ = value;
+  _impl_.errcode_ = value;
+}
+inline void ResultCode::set_errcode(int32_t value) {
+  _internal_set_errcode(value);
   // @@protoc_insertion_point(field_set:fixbug.ResultCode.errcode)
 }
 
 // bytes errmsg = 2;
 inline void ResultCode::clear_errmsg() {
-  errmsg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.errmsg_.ClearToEmpty();
 }
-inline const ::std::string& ResultCode::errmsg() const {
+inline const std::string& ResultCode::errmsg() const {
   // @@protoc_insertion_point(field_get:fixbug.ResultCode.errmsg)
-  return errmsg_.GetNoArena();
+  return _internal_errmsg();
 }
-inline void ResultCode::set_errmsg(const ::std::string& value) {
-  
-  errmsg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResultCode::set_errmsg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.errmsg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:fixbug.ResultCode.errmsg)
 }
-#if LANG_CXX11
-inline void ResultCode::set_errmsg(::std::string&& value) {
-  
-  errmsg_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:fixbug.ResultCode.errmsg)
+inline std::string* ResultCode::mutable_errmsg() {
+  std::string* _s = _internal_mutable_errmsg();
+  // @@protoc_insertion_point(field_mutable:fixbug.ResultCode.errmsg)
+  return _s;
 }
-#endif
-inline void ResultCode::set_errmsg(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  errmsg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:fixbug.ResultCode.errmsg)
+inline const std::string& ResultCode::_internal_errmsg() const {
+  return _impl_.errmsg_.Get();
 }
-inline void ResultCode::set_errmsg(const void* value, size_t size) {
+inline void ResultCode::_internal_set_errmsg(const std::string& value) {
   
-  errmsg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:fixbug.ResultCode.errmsg)
+  _impl_.errmsg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ResultCode::mutable_errmsg() {
+inline std::string* ResultCode::_internal_mutable_errmsg() {
   
-  // @@protoc_insertion_point(field_mutable:fixbug.ResultCode.errmsg)
-  return errmsg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.errmsg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ResultCode::release_errmsg() {
+inline std::string* ResultCode::release_errmsg() {
   // @@protoc_insertion_point(field_release:fixbug.ResultCode.errmsg)
-  
-  return errmsg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.errmsg_.Release();
 }
-inline void ResultCode::set_allocated_errmsg(::std::string* errmsg) {
-  if (errmsg != NULL) {
+inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
+  if (errmsg != nullptr) {
     
   } else {
     
   }
-  errmsg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), errmsg);
+  _impl_.errmsg_.SetAllocated(errmsg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.errmsg_.IsDefault()) {
+    _impl_.errmsg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:fixbug.ResultCode.errmsg)
 }
 
@@ -562,15 +885,21 @@ inline void ResultCode::set_allocated_errmsg(::std::string* errmsg) {
 
 // uint32 userid = 1;
 inline void GetFriendListRequest::clear_userid() {
-  userid_ = 0u;
+  _impl_.userid_ = 0u;
+}
+inline uint32_t GetFriendListRequest::_internal_userid() const {
+  return _impl_.userid_;
 }
-inline ::google::protobuf::uint32 GetFriendListRequest::userid() const {
+inline uint32_t GetFriendListRequest::userid() const {
   // @@protoc_insertion_point(field_get:fixbug.GetFriendListRequest.userid)
-  return userid_;
+  return _internal_userid();
 }
-inline void GetFriendListRequest::set_userid(::google::protobuf::uint32 value) {
+inline void GetFriendListRequest::_internal_set_userid(uint32_t value) {
   
-  userid_ = value;
+  _impl_.userid_ = value;
+}
+inline void GetFriendListRequest::set_userid(uint32_t value) {
+  _internal_set_userid(value);
   // @@protoc_insertion_point(field_set:fixbug.GetFriendListRequest.userid)
 }
 
@@ -579,126 +908,222 @@ inline void GetFriendListRequest::set_userid(::google::protobuf::uint32 value) {
 // GetFriendListResponse
 
 // .fixbug.ResultCode result = 1;
+inline bool GetFriendListResponse::_internal_has_result() const {
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
+}
 inline bool GetFriendListResponse::has_result() const {
-  return this != internal_default_instance() && result_ != NULL;
+  return _internal_has_result();
 }
 inline void GetFriendListResponse::clear_result() {
-  if (GetArenaNoVirtual() == NULL && result_ != NULL) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = NULL;
+  _impl_.result_ = nullptr;
 }
 inline const ::fixbug::ResultCode& GetFriendListResponse::_internal_result() const {
-  return *result_;
+  const ::fixbug::ResultCode* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fixbug::ResultCode&>(
+      ::fixbug::_ResultCode_default_instance_);
 }
 inline const ::fixbug::ResultCode& GetFriendListResponse::result() const {
-  const ::fixbug::ResultCode* p = result_;
   // @@protoc_insertion_point(field_get:fixbug.GetFriendListResponse.result)
-  return p != NULL ? *p : *reinterpret_cast<const ::fixbug::ResultCode*>(
-      &::fixbug::_ResultCode_default_instance_);
+  return _internal_result();
+}
+inline void GetFriendListResponse::unsafe_arena_set_allocated_result(
+    ::fixbug::ResultCode* result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
+  }
+  _impl_.result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fixbug.GetFriendListResponse.result)
 }
 inline ::fixbug::ResultCode* GetFriendListResponse::release_result() {
+  
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fixbug::ResultCode* GetFriendListResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:fixbug.GetFriendListResponse.result)
   
-  ::fixbug::ResultCode* temp = result_;
-  result_ = NULL;
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
-inline ::fixbug::ResultCode* GetFriendListResponse::mutable_result() {
+inline ::fixbug::ResultCode* GetFriendListResponse::_internal_mutable_result() {
   
-  if (result_ == NULL) {
-    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArenaNoVirtual());
-    result_ = p;
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArenaForAllocation());
+    _impl_.result_ = p;
   }
+  return _impl_.result_;
+}
+inline ::fixbug::ResultCode* GetFriendListResponse::mutable_result() {
+  ::fixbug::ResultCode* _msg = _internal_mutable_result();
   // @@protoc_insertion_point(field_mutable:fixbug.GetFriendListResponse.result)
-  return result_;
+  return _msg;
 }
 inline void GetFriendListResponse::set_allocated_result(::fixbug::ResultCode* result) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete result_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.result_;
   }
   if (result) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
     if (message_arena != submessage_arena) {
-      result = ::google::protobuf::internal::GetOwnedMessage(
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, result, submessage_arena);
     }
     
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:fixbug.GetFriendListResponse.result)
 }
 
 // repeated bytes friends = 2;
+inline int GetFriendListResponse::_internal_friends_size() const {
+  return _impl_.friends_.size();
+}
 inline int GetFriendListResponse::friends_size() const {
-  return friends_.size();
+  return _internal_friends_size();
 }
 inline void GetFriendListResponse::clear_friends() {
-  friends_.Clear();
+  _impl_.friends_.Clear();
+}
+inline std::string* GetFriendListResponse::add_friends() {
+  std::string* _s = _internal_add_friends();
+  // @@protoc_insertion_point(field_add_mutable:fixbug.GetFriendListResponse.friends)
+  return _s;
+}
+inline const std::string& GetFriendListResponse::_internal_friends(int index) const {
+  return _impl_.friends_.Get(index);
 }
-inline const ::std::string& GetFriendListResponse::friends(int index) const {
+inline const std::string& GetFriendListResponse::friends(int index) const {
   // @@protoc_insertion_point(field_get:fixbug.GetFriendListResponse.friends)
-  return friends_.Get(index);
+  return _internal_friends(index);
 }
-inline ::std::string* GetFriendListResponse::mutable_friends(int index) {
+inline std::string* GetFriendListResponse::mutable_friends(int index) {
   // @@protoc_insertion_point(field_mutable:fixbug.GetFriendListResponse.friends)
-  return friends_.Mutable(index);
+  return _impl_.friends_.Mutable(index);
 }
-inline void GetFriendListResponse::set_friends(int index, const ::std::string& value) {
+inline void GetFriendListResponse::set_friends(int index, const std::string& value) {
+  _impl_.friends_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:fixbug.GetFriendListResponse.friends)
-  friends_.Mutable(index)->assign(value);
 }
-#if LANG_CXX11
-inline void GetFriendListResponse::set_friends(int index, ::std::string&& value) {
+inline void GetFriendListResponse::set_friends(int index, std::string&& value) {
+  _impl_.friends_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:fixbug.GetFriendListResponse.friends)
-  friends_.Mutable(index)->assign(std::move(value));
 }
-#endif
 inline void GetFriendListResponse::set_friends(int index, const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  friends_.Mutable(index)->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.friends_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:fixbug.GetFriendListResponse.friends)
 }
 inline void GetFriendListResponse::set_friends(int index, const void* value, size_t size) {
-  friends_.Mutable(index)->assign(
+  _impl_.friends_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:fixbug.GetFriendListResponse.friends)
 }
-inline ::std::string* GetFriendListResponse::add_friends() {
-  // @@protoc_insertion_point(field_add_mutable:fixbug.GetFriendListResponse.friends)
-  return friends_.Add();
+inline std::string* GetFriendListResponse::_internal_add_friends() {
+  return _impl_.friends_.Add();
 }
-inline void GetFriendListResponse::add_friends(const ::std::string& value) {
-  friends_.Add()->assign(value);
+inline void GetFriendListResponse::add_friends(const std::string& value) {
+  _impl_.friends_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:fixbug.GetFriendListResponse.friends)
 }
-#if LANG_CXX11
-inline void GetFriendListResponse::add_friends(::std::string&& value) {
-  friends_.Add(std::move(value));
+inline void GetFriendListResponse::add_friends(std::string&& value) {
+  _impl_.friends_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:fixbug.GetFriendListResponse.friends)
 }
-#endif
 inline void GetFriendListResponse::add_friends(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  friends_.Add()->assign(value);
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.friends_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:fixbug.GetFriendListResponse.friends)
 }
 inline void GetFriendListResponse::add_friends(const void* value, size_t size) {
-  friends_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.friends_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:fixbug.GetFriendListResponse.friends)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 GetFriendListResponse::friends() const {
   // @@protoc_insertion_point(field_list:fixbug.GetFriendListResponse.friends)
-  return friends_;
+  return _impl_.friends_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 GetFriendListResponse::mutable_friends() {
   // @@protoc_insertion_point(field_mutable_list:fixbug.GetFriendListResponse.friends)
-  return &friends_;
+  return &_impl_.friends_;
+}
+
+// -------------------------------------------------------------------
+
+// FriendEntry
+
+// bytes name = 1;
+inline void FriendEntry::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& FriendEntry::name() const {
+  // @@protoc_insertion_point(field_get:fixbug.FriendEntry.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FriendEntry::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fixbug.FriendEntry.name)
+}
+inline std::string* FriendEntry::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:fixbug.FriendEntry.name)
+  return _s;
+}
+inline const std::string& FriendEntry::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void FriendEntry::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FriendEntry::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FriendEntry::release_name() {
+  // @@protoc_insertion_point(field_release:fixbug.FriendEntry.name)
+  return _impl_.name_.Release();
+}
+inline void FriendEntry::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fixbug.FriendEntry.name)
 }
 
 #ifdef __GNUC__
@@ -708,6 +1133,8 @@ GetFriendListResponse::mutable_friends() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -715,4 +1142,5 @@ GetFriendListResponse::mutable_friends() {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_friend_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_friend_2eproto
@@ -0,0 +1,172 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <zstd.h>
+#include <zdict.h>
+#include "mprpcapplication.h"
+#include "zookeeperutil.h"
+
+// 离线训练方法的zstd字典。样本是调用方配置rpc_dict_capture_dir后抓取的<服务>.<方法>.samples文件，
+// 每条样本为4字节网络序长度 + 未压缩的消息。每10条样本留出1条不参与训练，用来评估压缩效果。
+// 指定-p时把字典发布到zookeeper的<rpc_dict_zk_path>/<服务>.<方法>/dict顺序节点，
+// 已经运行的进程监听到新节点后就能解压用新字典压缩的消息，调用方重启后开始使用新字典压缩
+static bool ReadSamples(const std::string &path, std::string *data, std::vector<size_t> *sizes)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    uint32_t size = 0;
+    while (in.read(reinterpret_cast<char *>(&size), 4)) {
+        size = ntohl(size);
+        std::string sample(size, '\0');
+        if (!in.read(&sample[0], size)) {
+            break;
+        }
+        data->append(sample);
+        sizes->push_back(size);
+    }
+    return true;
+}
+
+// 逐条压缩留出的样本，返回压缩后的总大小；dict为空时不用字典
+static size_t CompressedSize(const std::string &data, const std::vector<size_t> &sizes, const std::string &dict, int level)
+{
+    ZSTD_CCtx *cctx = ZSTD_createCCtx();
+    ZSTD_CDict *cdict = dict.empty() ? nullptr : ZSTD_createCDict(dict.data(), dict.size(), level);
+    std::string out;
+    size_t total = 0;
+    size_t offset = 0;
+    for (size_t size : sizes) {
+        out.resize(ZSTD_compressBound(size));
+        size_t n = cdict != nullptr
+            ? ZSTD_compress_usingCDict(cctx, &out[0], out.size(), data.data() + offset, size, cdict)
+            : ZSTD_compressCCtx(cctx, &out[0], out.size(), data.data() + offset, size, level);
+        // 框架不发送压缩后没有变小的消息
+        total += ZSTD_isError(n) ? size : std::min(n, size);
+        offset += size;
+    }
+    ZSTD_freeCDict(cdict);
+    ZSTD_freeCCtx(cctx);
+    return total;
+}
+
+static bool Publish(const std::string &method_key, const std::string &dict)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    std::string root = config.Load("rpc_dict_zk_path");
+    if (root.empty()) {
+        std::cerr << "rpc_dict_zk_path is not configured" << std::endl;
+        return false;
+    }
+    ZkClient zk(config.Load("zookeeperip") + ":" + config.Load("zookeeperport"));
+    zk.Start();
+    if (!zk.IsConnected()) {
+        std::cerr << "connect zookeeper error" << std::endl;
+        return false;
+    }
+    // 逐级创建方法节点
+    std::string path = root + "/" + method_key;
+    for (size_t pos = 1; pos != std::string::npos;) {
+        pos = path.find('/', pos + 1);
+        std::string prefix = path.substr(0, pos);
+        if (!zk.Exists(prefix.c_str()) && zk.Create(prefix.c_str(), nullptr, 0, 0).empty()) {
+            return false;
+        }
+    }
+    std::string created = zk.Create((path + "/dict").c_str(), dict.data(), dict.size(), ZOO_SEQUENCE);
+    if (created.empty()) {
+        return false;
+    }
+    std::cout << "published " << created << std::endl;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    std::string samples_file;
+    std::string output_file;
+    std::string config_file;
+    std::string method_key;
+    size_t dict_size = 16 * 1024;
+    int level = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "s:o:k:l:i:p:")) != -1) {
+        switch (opt) {
+            case 's': samples_file = optarg; break;
+            case 'o': output_file = optarg; break;
+            case 'k': dict_size = atoi(optarg); break;
+            case 'l': level = atoi(optarg); break;
+            case 'i': config_file = optarg; break;
+            case 'p': method_key = optarg; break;
+            default:
+                std::cerr << "Usage: " << argv[0] << " -s <samples> -o <dict_file> [-k dict_bytes] [-l zstd_level]"
+                          << " [-i <config_file> -p <Service.Method>]" << std::endl;
+                return 1;
+        }
+    }
+    if (samples_file.empty() || output_file.empty() || (!method_key.empty() && config_file.empty())) {
+        std::cerr << "samples and output file must be specified, publishing requires -i" << std::endl;
+        return 1;
+    }
+
+    std::string data;
+    std::vector<size_t> sizes;
+    if (!ReadSamples(samples_file, &data, &sizes)) {
+        std::cerr << "read " << samples_file << " error" << std::endl;
+        return 1;
+    }
+    std::string train_data;
+    std::string test_data;
+    std::vector<size_t> train_sizes;
+    std::vector<size_t> test_sizes;
+    size_t offset = 0;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        if (i % 10 == 9) {
+            test_data.append(data, offset, sizes[i]);
+            test_sizes.push_back(sizes[i]);
+        } else {
+            train_data.append(data, offset, sizes[i]);
+            train_sizes.push_back(sizes[i]);
+        }
+        offset += sizes[i];
+    }
+    std::cout << "samples:" << sizes.size() << " bytes:" << data.size() << std::endl;
+
+    std::string dict(dict_size, '\0');
+    size_t n = ZDICT_trainFromBuffer(&dict[0], dict.size(), train_data.data(), train_sizes.data(), train_sizes.size());
+    if (ZDICT_isError(n)) {
+        // 样本太少或者太相似时训练失败，需要抓取更多样本
+        std::cerr << "train dictionary error: " << ZDICT_getErrorName(n) << std::endl;
+        return 1;
+    }
+    dict.resize(n);
+    std::cout << "dictionary id:" << ZDICT_getDictID(dict.data(), dict.size()) << " size:" << dict.size() << std::endl;
+
+    if (!test_sizes.empty()) {
+        size_t raw = test_data.size();
+        size_t plain = CompressedSize(test_data, test_sizes, "", level);
+        size_t with_dict = CompressedSize(test_data, test_sizes, dict, level);
+        std::cout << "held out samples:" << test_sizes.size() << " raw:" << raw
+                  << " zstd:" << plain << " zstd+dict:" << with_dict
+                  << " ratio:" << static_cast<double>(raw) / with_dict << std::endl;
+    }
+
+    std::ofstream out(output_file, std::ios::binary);
+    if (!out.write(dict.data(), dict.size())) {
+        std::cerr << "write " << output_file << " error" << std::endl;
+        return 1;
+    }
+    if (!method_key.empty()) {
+        MprpcApplication::InitFromConfig(config_file);
+        if (!Publish(method_key, dict)) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -1,111 +1,121 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: user.proto
 
-#ifndef PROTOBUF_INCLUDED_user_2eproto
-#define PROTOBUF_INCLUDED_user_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_user_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_user_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_user_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_user_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_user_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[5];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_user_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_user_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_user_2eproto;
 namespace fixbug {
 class LoginRequest;
-class LoginRequestDefaultTypeInternal;
+struct LoginRequestDefaultTypeInternal;
 extern LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
 class LoginResponse;
-class LoginResponseDefaultTypeInternal;
+struct LoginResponseDefaultTypeInternal;
 extern LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
 class RegisterRequest;
-class RegisterRequestDefaultTypeInternal;
+struct RegisterRequestDefaultTypeInternal;
 extern RegisterRequestDefaultTypeInternal _RegisterRequest_default_instance_;
 class RegisterResponse;
-class RegisterResponseDefaultTypeInternal;
+struct RegisterResponseDefaultTypeInternal;
 extern RegisterResponseDefaultTypeInternal _RegisterResponse_default_instance_;
 class ResultCode;
-class ResultCodeDefaultTypeInternal;
+struct ResultCodeDefaultTypeInternal;
 extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
 }  // namespace fixbug
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::fixbug::LoginRequest* Arena::CreateMaybeMessage<::fixbug::LoginRequest>(Arena*);
 template<> ::fixbug::LoginResponse* Arena::CreateMaybeMessage<::fixbug::LoginResponse>(Arena*);
 template<> ::fixbug::RegisterRequest* Arena::CreateMaybeMessage<::fixbug::RegisterRequest>(Arena*);
 template<> ::fixbug::RegisterResponse* Arena::CreateMaybeMessage<::fixbug::RegisterResponse>(Arena*);
 template<> ::fixbug::ResultCode* Arena::CreateMaybeMessage<::fixbug::ResultCode>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace fixbug {
 
 // ===================================================================
 
-class ResultCode : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.ResultCode) */ {
+class ResultCode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.ResultCode) */ {
  public:
-  ResultCode();
-  virtual ~ResultCode();
+  inline ResultCode() : ResultCode(nullptr) {}
+  ~ResultCode() override;
+  explicit PROTOBUF_CONSTEXPR ResultCode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ResultCode(const ResultCode& from);
-
-  inline ResultCode& operator=(const ResultCode& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   ResultCode(ResultCode&& from) noexcept
     : ResultCode() {
     *this = ::std::move(from);
   }
 
+  inline ResultCode& operator=(const ResultCode& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline ResultCode& operator=(ResultCode&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ResultCode& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResultCode& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ResultCode* internal_default_instance() {
     return reinterpret_cast<const ResultCode*>(
                &_ResultCode_default_instance_);
@@ -113,117 +123,163 @@ class ResultCode : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(ResultCode* other);
   friend void swap(ResultCode& a, ResultCode& b) {
     a.Swap(&b);
   }
+  inline void Swap(ResultCode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResultCode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ResultCode* New() const final {
-    return CreateMaybeMessage<ResultCode>(NULL);
-  }
-
-  ResultCode* New(::google::protobuf::Arena* arena) const final {
+  ResultCode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ResultCode>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ResultCode& from);
-  void MergeFrom(const ResultCode& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResultCode& from) {
+    ResultCode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ResultCode* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.ResultCode";
   }
+  protected:
+  explicit ResultCode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrmsgFieldNumber = 2,
+    kErrcodeFieldNumber = 1,
+  };
   // bytes errmsg = 2;
   void clear_errmsg();
-  static const int kErrmsgFieldNumber = 2;
-  const ::std::string& errmsg() const;
-  void set_errmsg(const ::std::string& value);
-  #if LANG_CXX11
-  void set_errmsg(::std::string&& value);
-  #endif
-  void set_errmsg(const char* value);
-  void set_errmsg(const void* value, size_t size);
-  ::std::string* mutable_errmsg();
-  ::std::string* release_errmsg();
-  void set_allocated_errmsg(::std::string* errmsg);
+  const std::string& errmsg() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_errmsg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_errmsg();
+  PROTOBUF_NODISCARD std::string* release_errmsg();
+  void set_allocated_errmsg(std::string* errmsg);
+  private:
+  const std::string& _internal_errmsg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_errmsg(const std::string& value);
+  std::string* _internal_mutable_errmsg();
+  public:
 
   // int32 errcode = 1;
   void clear_errcode();
-  static const int kErrcodeFieldNumber = 1;
-  ::google::protobuf::int32 errcode() const;
-  void set_errcode(::google::protobuf::int32 value);
+  int32_t errcode() const;
+  void set_errcode(int32_t value);
+  private:
+  int32_t _internal_errcode() const;
+  void _internal_set_errcode(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:fixbug.ResultCode)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr errmsg_;
-  ::google::protobuf::int32 errcode_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_user_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
+    int32_t errcode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.LoginRequest) */ {
+class LoginRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.LoginRequest) */ {
  public:
-  LoginRequest();
-  virtual ~LoginRequest();
+  inline LoginRequest() : LoginRequest(nullptr) {}
+  ~LoginRequest() override;
+  explicit PROTOBUF_CONSTEXPR LoginRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginRequest(const LoginRequest& from);
-
-  inline LoginRequest& operator=(const LoginRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LoginRequest(LoginRequest&& from) noexcept
     : LoginRequest() {
     *this = ::std::move(from);
   }
 
+  inline LoginRequest& operator=(const LoginRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LoginRequest& operator=(LoginRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LoginRequest* internal_default_instance() {
     return reinterpret_cast<const LoginRequest*>(
                &_LoginRequest_default_instance_);
@@ -231,125 +287,168 @@ class LoginRequest : public ::google::protobuf::Message /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(LoginRequest* other);
   friend void swap(LoginRequest& a, LoginRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(LoginRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginRequest* New() const final {
-    return CreateMaybeMessage<LoginRequest>(NULL);
-  }
-
-  LoginRequest* New(::google::protobuf::Arena* arena) const final {
+  LoginRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginRequest& from);
-  void MergeFrom(const LoginRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginRequest& from) {
+    LoginRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.LoginRequest";
   }
+  protected:
+  explicit LoginRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kPwdFieldNumber = 2,
+  };
   // bytes name = 1;
   void clear_name();
-  static const int kNameFieldNumber = 1;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const void* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // bytes pwd = 2;
   void clear_pwd();
-  static const int kPwdFieldNumber = 2;
-  const ::std::string& pwd() const;
-  void set_pwd(const ::std::string& value);
-  #if LANG_CXX11
-  void set_pwd(::std::string&& value);
-  #endif
-  void set_pwd(const char* value);
-  void set_pwd(const void* value, size_t size);
-  ::std::string* mutable_pwd();
-  ::std::string* release_pwd();
-  void set_allocated_pwd(::std::string* pwd);
+  const std::string& pwd() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwd(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwd();
+  PROTOBUF_NODISCARD std::string* release_pwd();
+  void set_allocated_pwd(std::string* pwd);
+  private:
+  const std::string& _internal_pwd() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwd(const std::string& value);
+  std::string* _internal_mutable_pwd();
+  public:
 
   // @@protoc_insertion_point(class_scope:fixbug.LoginRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr pwd_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_user_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.LoginResponse) */ {
+class LoginResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.LoginResponse) */ {
  public:
-  LoginResponse();
-  virtual ~LoginResponse();
+  inline LoginResponse() : LoginResponse(nullptr) {}
+  ~LoginResponse() override;
+  explicit PROTOBUF_CONSTEXPR LoginResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginResponse(const LoginResponse& from);
-
-  inline LoginResponse& operator=(const LoginResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LoginResponse(LoginResponse&& from) noexcept
     : LoginResponse() {
     *this = ::std::move(from);
   }
 
+  inline LoginResponse& operator=(const LoginResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LoginResponse& operator=(LoginResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LoginResponse* internal_default_instance() {
     return reinterpret_cast<const LoginResponse*>(
                &_LoginResponse_default_instance_);
@@ -357,115 +456,167 @@ class LoginResponse : public ::google::protobuf::Message /* @@protoc_insertion_p
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(LoginResponse* other);
   friend void swap(LoginResponse& a, LoginResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(LoginResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginResponse* New() const final {
-    return CreateMaybeMessage<LoginResponse>(NULL);
-  }
-
-  LoginResponse* New(::google::protobuf::Arena* arena) const final {
+  LoginResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginResponse& from);
-  void MergeFrom(const LoginResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginResponse& from) {
+    LoginResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.LoginResponse";
   }
+  protected:
+  explicit LoginResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kResultFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+  };
   // .fixbug.ResultCode result = 1;
   bool has_result() const;
-  void clear_result();
-  static const int kResultFieldNumber = 1;
   private:
-  const ::fixbug::ResultCode& _internal_result() const;
+  bool _internal_has_result() const;
   public:
+  void clear_result();
   const ::fixbug::ResultCode& result() const;
-  ::fixbug::ResultCode* release_result();
+  PROTOBUF_NODISCARD ::fixbug::ResultCode* release_result();
   ::fixbug::ResultCode* mutable_result();
   void set_allocated_result(::fixbug::ResultCode* result);
+  private:
+  const ::fixbug::ResultCode& _internal_result() const;
+  ::fixbug::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::fixbug::ResultCode* result);
+  ::fixbug::ResultCode* unsafe_arena_release_result();
 
   // bool success = 2;
   void clear_success();
-  static const int kSuccessFieldNumber = 2;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:fixbug.LoginResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::fixbug::ResultCode* result_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_user_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fixbug::ResultCode* result_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RegisterRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.RegisterRequest) */ {
+class RegisterRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.RegisterRequest) */ {
  public:
-  RegisterRequest();
-  virtual ~RegisterRequest();
+  inline RegisterRequest() : RegisterRequest(nullptr) {}
+  ~RegisterRequest() override;
+  explicit PROTOBUF_CONSTEXPR RegisterRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RegisterRequest(const RegisterRequest& from);
-
-  inline RegisterRequest& operator=(const RegisterRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RegisterRequest(RegisterRequest&& from) noexcept
     : RegisterRequest() {
     *this = ::std::move(from);
   }
 
+  inline RegisterRequest& operator=(const RegisterRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RegisterRequest& operator=(RegisterRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RegisterRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RegisterRequest* internal_default_instance() {
     return reinterpret_cast<const RegisterRequest*>(
                &_RegisterRequest_default_instance_);
@@ -473,132 +624,179 @@ class RegisterRequest : public ::google::protobuf::Message /* @@protoc_insertion
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(RegisterRequest* other);
   friend void swap(RegisterRequest& a, RegisterRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(RegisterRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RegisterRequest* New() const final {
-    return CreateMaybeMessage<RegisterRequest>(NULL);
-  }
-
-  RegisterRequest* New(::google::protobuf::Arena* arena) const final {
+  RegisterRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RegisterRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RegisterRequest& from);
-  void MergeFrom(const RegisterRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterRequest& from) {
+    RegisterRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RegisterRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.RegisterRequest";
   }
+  protected:
+  explicit RegisterRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 2,
+    kPwdFieldNumber = 3,
+    kIdFieldNumber = 1,
+  };
   // bytes name = 2;
   void clear_name();
-  static const int kNameFieldNumber = 2;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const void* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // bytes pwd = 3;
   void clear_pwd();
-  static const int kPwdFieldNumber = 3;
-  const ::std::string& pwd() const;
-  void set_pwd(const ::std::string& value);
-  #if LANG_CXX11
-  void set_pwd(::std::string&& value);
-  #endif
-  void set_pwd(const char* value);
-  void set_pwd(const void* value, size_t size);
-  ::std::string* mutable_pwd();
-  ::std::string* release_pwd();
-  void set_allocated_pwd(::std::string* pwd);
+  const std::string& pwd() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pwd(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pwd();
+  PROTOBUF_NODISCARD std::string* release_pwd();
+  void set_allocated_pwd(std::string* pwd);
+  private:
+  const std::string& _internal_pwd() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pwd(const std::string& value);
+  std::string* _internal_mutable_pwd();
+  public:
 
   // uint32 id = 1;
   void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::uint32 id() const;
-  void set_id(::google::protobuf::uint32 value);
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:fixbug.RegisterRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::internal::ArenaStringPtr pwd_;
-  ::google::protobuf::uint32 id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_user_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pwd_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_user_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RegisterResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:fixbug.RegisterResponse) */ {
+class RegisterResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fixbug.RegisterResponse) */ {
  public:
-  RegisterResponse();
-  virtual ~RegisterResponse();
+  inline RegisterResponse() : RegisterResponse(nullptr) {}
+  ~RegisterResponse() override;
+  explicit PROTOBUF_CONSTEXPR RegisterResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RegisterResponse(const RegisterResponse& from);
-
-  inline RegisterResponse& operator=(const RegisterResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RegisterResponse(RegisterResponse&& from) noexcept
     : RegisterResponse() {
     *this = ::std::move(from);
   }
 
+  inline RegisterResponse& operator=(const RegisterResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RegisterResponse& operator=(RegisterResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RegisterResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RegisterResponse* internal_default_instance() {
     return reinterpret_cast<const RegisterResponse*>(
                &_RegisterResponse_default_instance_);
@@ -606,88 +804,127 @@ class RegisterResponse : public ::google::protobuf::Message /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(RegisterResponse* other);
   friend void swap(RegisterResponse& a, RegisterResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(RegisterResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RegisterResponse* New() const final {
-    return CreateMaybeMessage<RegisterResponse>(NULL);
-  }
-
-  RegisterResponse* New(::google::protobuf::Arena* arena) const final {
+  RegisterResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RegisterResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RegisterResponse& from);
-  void MergeFrom(const RegisterResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterResponse& from) {
+    RegisterResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RegisterResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fixbug.RegisterResponse";
   }
+  protected:
+  explicit RegisterResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kResultFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+  };
   // .fixbug.ResultCode result = 1;
   bool has_result() const;
-  void clear_result();
-  static const int kResultFieldNumber = 1;
   private:
-  const ::fixbug::ResultCode& _internal_result() const;
+  bool _internal_has_result() const;
   public:
+  void clear_result();
   const ::fixbug::ResultCode& result() const;
-  ::fixbug::ResultCode* release_result();
+  PROTOBUF_NODISCARD ::fixbug::ResultCode* release_result();
   ::fixbug::ResultCode* mutable_result();
   void set_allocated_result(::fixbug::ResultCode* result);
+  private:
+  const ::fixbug::ResultCode& _internal_result() const;
+  ::fixbug::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::fixbug::ResultCode* result);
+  ::fixbug::ResultCode* unsafe_arena_release_result();
 
   // bool success = 2;
   void clear_success();
-  static const int kSuccessFieldNumber = 2;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:fixbug.RegisterResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::fixbug::ResultCode* result_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_user_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fixbug::ResultCode* result_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_user_2eproto;
 };
 // ===================================================================
 
 class UserServiceRpc_Stub;
 
-class UserServiceRpc : public ::google::protobuf::Service {
+class UserServiceRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
  protected:
   // This class should be treated as an abstract interface.
   inline UserServiceRpc() {};
@@ -696,29 +933,29 @@ class UserServiceRpc : public ::google::protobuf::Service {
 
   typedef UserServiceRpc_Stub Stub;
 
-  static const ::google::protobuf::ServiceDescriptor* descriptor();
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
 
-  virtual void Login(::google::protobuf::RpcController* controller,
+  virtual void Login(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::fixbug::LoginRequest* request,
                        ::fixbug::LoginResponse* response,
                        ::google::protobuf::Closure* done);
-  virtual void Register(::google::protobuf::RpcController* controller,
+  virtual void Register(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::fixbug::RegisterRequest* request,
                        ::fixbug::RegisterResponse* response,
                        ::google::protobuf::Closure* done);
 
   // implements Service ----------------------------------------------
 
-  const ::google::protobuf::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::google::protobuf::MethodDescriptor* method,
-                  ::google::protobuf::RpcController* controller,
-                  const ::google::protobuf::Message* request,
-                  ::google::protobuf::Message* response,
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
                   ::google::protobuf::Closure* done);
-  const ::google::protobuf::Message& GetRequestPrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
-  const ::google::protobuf::Message& GetResponsePrototype(
-    const ::google::protobuf::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
 
  private:
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(UserServiceRpc);
@@ -726,25 +963,25 @@ class UserServiceRpc : public ::google::protobuf::Service {
 
 class UserServiceRpc_Stub : public UserServiceRpc {
  public:
-  UserServiceRpc_Stub(::google::protobuf::RpcChannel* channel);
-  UserServiceRpc_Stub(::google::protobuf::RpcChannel* channel,
-                   ::google::protobuf::Service::ChannelOwnership ownership);
+  UserServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  UserServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
   ~UserServiceRpc_Stub();
 
-  inline ::google::protobuf::RpcChannel* channel() { return channel_; }
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
 
   // implements UserServiceRpc ------------------------------------------
 
-  void Login(::google::protobuf::RpcController* controller,
+  void Login(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::fixbug::LoginRequest* request,
                        ::fixbug::LoginResponse* response,
                        ::google::protobuf::Closure* done);
-  void Register(::google::protobuf::RpcController* controller,
+  void Register(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                        const ::fixbug::RegisterRequest* request,
                        ::fixbug::RegisterResponse* response,
                        ::google::protobuf::Closure* done);
  private:
-  ::google::protobuf::RpcChannel* channel_;
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
   bool owns_channel_;
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(UserServiceRpc_Stub);
 };
@@ -763,68 +1000,71 @@ class UserServiceRpc_Stub : public UserServiceRpc {
 
 // int32 errcode = 1;
 inline void ResultCode::clear_errcode() {
-  errcode_ = 0;
+  _impl_.errcode_ = 0;
 }
-inline ::google::protobuf::int32 ResultCode::errcode() const {
+inline int32_t ResultCode::_internal_errcode() const {
+  return _impl_.errcode_;
+}
+inline int32_t ResultCode::errcode() const {
   // @@protoc_insertion_point(field_get:fixbug.ResultCode.errcode)
-  return errcode_;
+  return _internal_errcode();
 }
-inline void ResultCode::set_errcode(::google::protobuf::int32 value) {
+inline void ResultCode::_internal_set_errcode(int32_t value) {
   
-  errcode_ = value;
+  _impl_.errcode_ = value;
+}
+inline void ResultCode::set_errcode(int32_t value) {
+  _internal_set_errcode(value);
   // @@protoc_insertion_point(field_set:fixbug.ResultCode.errcode)
 }
 
 // bytes errmsg = 2;
 inline void ResultCode::clear_errmsg() {
-  errmsg_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.errmsg_.ClearToEmpty();
 }
-inline const ::std::string& ResultCode::errmsg() const {
+inline const std::string& ResultCode::errmsg() const {
   // @@protoc_insertion_point(field_get:fixbug.ResultCode.errmsg)
-  return errmsg_.GetNoArena();
+  return _internal_errmsg();
 }
-inline void ResultCode::set_errmsg(const ::std::string& value) {
-  
-  errmsg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResultCode::set_errmsg(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.errmsg_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:fixbug.ResultCode.errmsg)
 }
-#if LANG_CXX11
-inline void ResultCode::set_errmsg(::std::string&& value) {
-  
-  errmsg_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:fixbug.ResultCode.errmsg)
+inline std::string* ResultCode::mutable_errmsg() {
+  std::string* _s = _internal_mutable_errmsg();
+  // @@protoc_insertion_point(field_mutable:fixbug.ResultCode.errmsg)
+  return _s;
 }
-#endif
-inline void ResultCode::set_errmsg(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  errmsg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:fixbug.ResultCode.errmsg)
+inline const std::string& ResultCode::_internal_errmsg() const {
+  return _impl_.errmsg_.Get();
 }
-inline void ResultCode::set_errmsg(const void* value, size_t size) {
+inline void ResultCode::_internal_set_errmsg(const std::string& value) {
   
-  errmsg_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:fixbug.ResultCode.errmsg)
+  _impl_.errmsg_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* ResultCode::mutable_errmsg() {
+inline std::string* ResultCode::_internal_mutable_errmsg() {
   
-  // @@protoc_insertion_point(field_mutable:fixbug.ResultCode.errmsg)
-  return errmsg_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.errmsg_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* ResultCode::release_errmsg() {
+inline std::string* ResultCode::release_errmsg() {
   // @@protoc_insertion_point(field_release:fixbug.ResultCode.errmsg)
-  
-  return errmsg_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.errmsg_.Release();
 }
-inline void ResultCode::set_allocated_errmsg(::std::string* errmsg) {
-  if (errmsg != NULL) {
+inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
+  if (errmsg != nullptr) {
     
   } else {
     
   }
-  errmsg_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), errmsg);
+  _impl_.errmsg_.SetAllocated(errmsg, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.errmsg_.IsDefault()) {
+    _impl_.errmsg_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:fixbug.ResultCode.errmsg)
 }
 
@@ -834,107 +1074,101 @@ inline void ResultCode::set_allocated_errmsg(::std::string* errmsg) {
 
 // bytes name = 1;
 inline void LoginRequest::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& LoginRequest::name() const {
+inline const std::string& LoginRequest::name() const {
   // @@protoc_insertion_point(field_get:fixbug.LoginRequest.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void LoginRequest::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:fixbug.LoginRequest.name)
 }
-#if LANG_CXX11
-inline void LoginRequest::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:fixbug.LoginRequest.name)
+inline std::string* LoginRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:fixbug.LoginRequest.name)
+  return _s;
 }
-#endif
-inline void LoginRequest::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:fixbug.LoginRequest.name)
+inline const std::string& LoginRequest::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void LoginRequest::set_name(const void* value, size_t size) {
+inline void LoginRequest::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:fixbug.LoginRequest.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LoginRequest::mutable_name() {
+inline std::string* LoginRequest::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:fixbug.LoginRequest.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* LoginRequest::release_name() {
+inline std::string* LoginRequest::release_name() {
   // @@protoc_insertion_point(field_release:fixbug.LoginRequest.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void LoginRequest::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void LoginRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:fixbug.LoginRequest.name)
 }
 
 // bytes pwd = 2;
 inline void LoginRequest::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwd_.ClearToEmpty();
 }
-inline const ::std::string& LoginRequest::pwd() const {
+inline const std::string& LoginRequest::pwd() const {
   // @@protoc_insertion_point(field_get:fixbug.LoginRequest.pwd)
-  return pwd_.GetNoArena();
+  return _internal_pwd();
 }
-inline void LoginRequest::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_pwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:fixbug.LoginRequest.pwd)
 }
-#if LANG_CXX11
-inline void LoginRequest::set_pwd(::std::string&& value) {
-  
-  pwd_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:fixbug.LoginRequest.pwd)
+inline std::string* LoginRequest::mutable_pwd() {
+  std::string* _s = _internal_mutable_pwd();
+  // @@protoc_insertion_point(field_mutable:fixbug.LoginRequest.pwd)
+  return _s;
 }
-#endif
-inline void LoginRequest::set_pwd(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:fixbug.LoginRequest.pwd)
+inline const std::string& LoginRequest::_internal_pwd() const {
+  return _impl_.pwd_.Get();
 }
-inline void LoginRequest::set_pwd(const void* value, size_t size) {
+inline void LoginRequest::_internal_set_pwd(const std::string& value) {
   
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:fixbug.LoginRequest.pwd)
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LoginRequest::mutable_pwd() {
+inline std::string* LoginRequest::_internal_mutable_pwd() {
   
-  // @@protoc_insertion_point(field_mutable:fixbug.LoginRequest.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* LoginRequest::release_pwd() {
+inline std::string* LoginRequest::release_pwd() {
   // @@protoc_insertion_point(field_release:fixbug.LoginRequest.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Release();
 }
-inline void LoginRequest::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
+inline void LoginRequest::set_allocated_pwd(std::string* pwd) {
+  if (pwd != nullptr) {
     
   } else {
     
   }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:fixbug.LoginRequest.pwd)
 }
 
@@ -943,70 +1177,112 @@ inline void LoginRequest::set_allocated_pwd(::std::string* pwd) {
 // LoginResponse
 
 // .fixbug.ResultCode result = 1;
+inline bool LoginResponse::_internal_has_result() const {
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
+}
 inline bool LoginResponse::has_result() const {
-  return this != internal_default_instance() && result_ != NULL;
+  return _internal_has_result();
 }
 inline void LoginResponse::clear_result() {
-  if (GetArenaNoVirtual() == NULL && result_ != NULL) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = NULL;
+  _impl_.result_ = nullptr;
 }
 inline const ::fixbug::ResultCode& LoginResponse::_internal_result() const {
-  return *result_;
+  const ::fixbug::ResultCode* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fixbug::ResultCode&>(
+      ::fixbug::_ResultCode_default_instance_);
 }
 inline const ::fixbug::ResultCode& LoginResponse::result() const {
-  const ::fixbug::ResultCode* p = result_;
   // @@protoc_insertion_point(field_get:fixbug.LoginResponse.result)
-  return p != NULL ? *p : *reinterpret_cast<const ::fixbug::ResultCode*>(
-      &::fixbug::_ResultCode_default_instance_);
+  return _internal_result();
+}
+inline void LoginResponse::unsafe_arena_set_allocated_result(
+    ::fixbug::ResultCode* result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
+  }
+  _impl_.result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fixbug.LoginResponse.result)
 }
 inline ::fixbug::ResultCode* LoginResponse::release_result() {
+  
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fixbug::ResultCode* LoginResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:fixbug.LoginResponse.result)
   
-  ::fixbug::ResultCode* temp = result_;
-  result_ = NULL;
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
-inline ::fixbug::ResultCode* LoginResponse::mutable_result() {
+inline ::fixbug::ResultCode* LoginResponse::_internal_mutable_result() {
   
-  if (result_ == NULL) {
-    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArenaNoVirtual());
-    result_ = p;
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArenaForAllocation());
+    _impl_.result_ = p;
   }
+  return _impl_.result_;
+}
+inline ::fixbug::ResultCode* LoginResponse::mutable_result() {
+  ::fixbug::ResultCode* _msg = _internal_mutable_result();
   // @@protoc_insertion_point(field_mutable:fixbug.LoginResponse.result)
-  return result_;
+  return _msg;
 }
 inline void LoginResponse::set_allocated_result(::fixbug::ResultCode* result) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete result_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.result_;
   }
   if (result) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
     if (message_arena != submessage_arena) {
-      result = ::google::protobuf::internal::GetOwnedMessage(
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, result, submessage_arena);
     }
     
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:fixbug.LoginResponse.result)
 }
 
 // bool success = 2;
 inline void LoginResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool LoginResponse::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool LoginResponse::success() const {
   // @@protoc_insertion_point(field_get:fixbug.LoginResponse.success)
-  return success_;
+  return _internal_success();
 }
-inline void LoginResponse::set_success(bool value) {
+inline void LoginResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void LoginResponse::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:fixbug.LoginResponse.success)
 }
 
@@ -1016,121 +1292,121 @@ inline void LoginResponse::set_success(bool value) {
 
 // uint32 id = 1;
 inline void RegisterRequest::clear_id() {
-  id_ = 0u;
+  _impl_.id_ = 0u;
 }
-inline ::google::protobuf::uint32 RegisterRequest::id() const {
+inline uint32_t RegisterRequest::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t RegisterRequest::id() const {
   // @@protoc_insertion_point(field_get:fixbug.RegisterRequest.id)
-  return id_;
+  return _internal_id();
 }
-inline void RegisterRequest::set_id(::google::protobuf::uint32 value) {
+inline void RegisterRequest::_internal_set_id(uint32_t value) {
   
-  id_ = value;
+  _impl_.id_ = value;
+}
+inline void RegisterRequest::set_id(uint32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:fixbug.RegisterRequest.id)
 }
 
 // bytes name = 2;
 inline void RegisterRequest::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& RegisterRequest::name() const {
+inline const std::string& RegisterRequest::name() const {
   // @@protoc_insertion_point(field_get:fixbug.RegisterRequest.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void RegisterRequest::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:fixbug.RegisterRequest.name)
 }
-#if LANG_CXX11
-inline void RegisterRequest::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:fixbug.RegisterRequest.name)
+inline std::string* RegisterRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:fixbug.RegisterRequest.name)
+  return _s;
 }
-#endif
-inline void RegisterRequest::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:fixbug.RegisterRequest.name)
+inline const std::string& RegisterRequest::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void RegisterRequest::set_name(const void* value, size_t size) {
+inline void RegisterRequest::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:fixbug.RegisterRequest.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RegisterRequest::mutable_name() {
+inline std::string* RegisterRequest::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:fixbug.RegisterRequest.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RegisterRequest::release_name() {
+inline std::string* RegisterRequest::release_name() {
   // @@protoc_insertion_point(field_release:fixbug.RegisterRequest.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void RegisterRequest::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void RegisterRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:fixbug.RegisterRequest.name)
 }
 
 // bytes pwd = 3;
 inline void RegisterRequest::clear_pwd() {
-  pwd_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pwd_.ClearToEmpty();
 }
-inline const ::std::string& RegisterRequest::pwd() const {
+inline const std::string& RegisterRequest::pwd() const {
   // @@protoc_insertion_point(field_get:fixbug.RegisterRequest.pwd)
-  return pwd_.GetNoArena();
+  return _internal_pwd();
 }
-inline void RegisterRequest::set_pwd(const ::std::string& value) {
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterRequest::set_pwd(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.pwd_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:fixbug.RegisterRequest.pwd)
 }
-#if LANG_CXX11
-inline void RegisterRequest::set_pwd(::std::string&& value) {
-  
-  pwd_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:fixbug.RegisterRequest.pwd)
+inline std::string* RegisterRequest::mutable_pwd() {
+  std::string* _s = _internal_mutable_pwd();
+  // @@protoc_insertion_point(field_mutable:fixbug.RegisterRequest.pwd)
+  return _s;
 }
-#endif
-inline void RegisterRequest::set_pwd(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:fixbug.RegisterRequest.pwd)
+inline const std::string& RegisterRequest::_internal_pwd() const {
+  return _impl_.pwd_.Get();
 }
-inline void RegisterRequest::set_pwd(const void* value, size_t size) {
+inline void RegisterRequest::_internal_set_pwd(const std::string& value) {
   
-  pwd_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:fixbug.RegisterRequest.pwd)
+  _impl_.pwd_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RegisterRequest::mutable_pwd() {
+inline std::string* RegisterRequest::_internal_mutable_pwd() {
   
-  // @@protoc_insertion_point(field_mutable:fixbug.RegisterRequest.pwd)
-  return pwd_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RegisterRequest::release_pwd() {
+inline std::string* RegisterRequest::release_pwd() {
   // @@protoc_insertion_point(field_release:fixbug.RegisterRequest.pwd)
-  
-  return pwd_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.pwd_.Release();
 }
-inline void RegisterRequest::set_allocated_pwd(::std::string* pwd) {
-  if (pwd != NULL) {
+inline void RegisterRequest::set_allocated_pwd(std::string* pwd) {
+  if (pwd != nullptr) {
     
   } else {
     
   }
-  pwd_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), pwd);
+  _impl_.pwd_.SetAllocated(pwd, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.pwd_.IsDefault()) {
+    _impl_.pwd_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:fixbug.RegisterRequest.pwd)
 }
 
@@ -1139,70 +1415,112 @@ inline void RegisterRequest::set_allocated_pwd(::std::string* pwd) {
 // RegisterResponse
 
 // .fixbug.ResultCode result = 1;
+inline bool RegisterResponse::_internal_has_result() const {
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
+}
 inline bool RegisterResponse::has_result() const {
-  return this != internal_default_instance() && result_ != NULL;
+  return _internal_has_result();
 }
 inline void RegisterResponse::clear_result() {
-  if (GetArenaNoVirtual() == NULL && result_ != NULL) {
-    delete result_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  result_ = NULL;
+  _impl_.result_ = nullptr;
 }
 inline const ::fixbug::ResultCode& RegisterResponse::_internal_result() const {
-  return *result_;
+  const ::fixbug::ResultCode* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fixbug::ResultCode&>(
+      ::fixbug::_ResultCode_default_instance_);
 }
 inline const ::fixbug::ResultCode& RegisterResponse::result() const {
-  const ::fixbug::ResultCode* p = result_;
   // @@protoc_insertion_point(field_get:fixbug.RegisterResponse.result)
-  return p != NULL ? *p : *reinterpret_cast<const ::fixbug::ResultCode*>(
-      &::fixbug::_ResultCode_default_instance_);
+  return _internal_result();
+}
+inline void RegisterResponse::unsafe_arena_set_allocated_result(
+    ::fixbug::ResultCode* result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
+  }
+  _impl_.result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fixbug.RegisterResponse.result)
 }
 inline ::fixbug::ResultCode* RegisterResponse::release_result() {
+  
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fixbug::ResultCode* RegisterResponse::unsafe_arena_release_result() {
   // @@protoc_insertion_point(field_release:fixbug.RegisterResponse.result)
   
-  ::fixbug::ResultCode* temp = result_;
-  result_ = NULL;
+  ::fixbug::ResultCode* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
   return temp;
 }
-inline ::fixbug::ResultCode* RegisterResponse::mutable_result() {
+inline ::fixbug::ResultCode* RegisterResponse::_internal_mutable_result() {
   
-  if (result_ == NULL) {
-    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArenaNoVirtual());
-    result_ = p;
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fixbug::ResultCode>(GetArenaForAllocation());
+    _impl_.result_ = p;
   }
+  return _impl_.result_;
+}
+inline ::fixbug::ResultCode* RegisterResponse::mutable_result() {
+  ::fixbug::ResultCode* _msg = _internal_mutable_result();
   // @@protoc_insertion_point(field_mutable:fixbug.RegisterResponse.result)
-  return result_;
+  return _msg;
 }
 inline void RegisterResponse::set_allocated_result(::fixbug::ResultCode* result) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete result_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.result_;
   }
   if (result) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
     if (message_arena != submessage_arena) {
-      result = ::google::protobuf::internal::GetOwnedMessage(
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, result, submessage_arena);
     }
     
   } else {
     
   }
-  result_ = result;
+  _impl_.result_ = result;
   // @@protoc_insertion_point(field_set_allocated:fixbug.RegisterResponse.result)
 }
 
 // bool success = 2;
 inline void RegisterResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool RegisterResponse::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool RegisterResponse::success() const {
   // @@protoc_insertion_point(field_get:fixbug.RegisterResponse.success)
-  return success_;
+  return _internal_success();
 }
-inline void RegisterResponse::set_success(bool value) {
+inline void RegisterResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void RegisterResponse::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:fixbug.RegisterResponse.success)
 }
 
@@ -1224,4 +1542,5 @@ inline void RegisterResponse::set_success(bool value) {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_user_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_user_2eproto
@@ -3,14 +3,41 @@
 #include <google/protobuf/service.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/message.h>
+#include <string>
+#include <memory>
+#include "rpctransport.h"
+
+class RpcStreamController;
 
 class MprpcChannel:public google::protobuf::RpcChannel
 {
 public:
+    //rpc_prefer_unix=true：zookeeper上登记的provider和调用方在同一台机器并且开放了unix socket时，
+    //直接通过unix socket调用，不经过nginx和TCP协议栈
+    MprpcChannel();
+    void SetPreferUnix(bool prefer) { m_preferUnix=prefer; }
+    //按名字选择RpcTransportRegistry中登记的传输，没有这个名字时返回false，见rpctransport.h
+    bool SetTransport(const std::string& name);
+    //TCP调用改用io_uring传输，等同于SetTransport("uring")
+    void SetIoUring(bool enable) { SetTransport(enable ? "uring" : "tcp"); }
+
     //所有通过stub代理对象调用的方法，都走到了这里，统一做rpc方法调用数据的序列化和网络发送
     void CallMethod(const google::protobuf::MethodDescriptor* method,
                           google::protobuf::RpcController* controller, const google::protobuf::Message* request,
                           google::protobuf::Message* response, google::protobuf::Closure* done);
+
+private:
+    //完成一次请求的发送和响应的接收，返回服务端的RpcStatus，网络错误返回-1
+    int SendAndRecv(const RpcEndpoint& endpoint, const std::string& send_rpc_str, uint64_t request_id,
+                    google::protobuf::Message* response, google::protobuf::RpcController* controller,
+                    uint32_t* response_size);
+    //服务端流式调用：逐条接收消息交给controller的回调，并按处理进度向provider授予配额
+    int SendAndRecvStream(const RpcEndpoint& endpoint, const std::string& send_rpc_str, uint64_t request_id,
+                          google::protobuf::Message* response, RpcStreamController* controller,
+                          uint32_t* response_size);
+
+    bool m_preferUnix;
+    std::shared_ptr<RpcClientTransport> m_transport;
 };
 
 
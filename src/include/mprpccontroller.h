@@ -10,6 +10,9 @@ public:
     bool Failed() const;
     std::string ErrorText() const;
     void SetFailed(const std::string& reason);
+    //服务端返回的RpcStatus，例如RPC_OVERLOADED表示可以换节点重试
+    void SetErrorCode(int code);
+    int ErrorCode() const;
 
     //目前未实现
     void StartCancel(); 
@@ -18,4 +21,5 @@ public:
 private:
     bool m_failed;//RPC方法执行过程中的状态
     std::string m_errText;//RPC方法执行过程中的错误信息
+    int m_errCode;//服务端返回的错误状态码
 };
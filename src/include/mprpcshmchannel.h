@@ -0,0 +1,45 @@
+#pragma once
+#include <google/protobuf/service.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include "rpcshmring.h"
+
+// 通过共享内存调用同机provider的channel，用法和MprpcChannel相同，给对延迟敏感的调用方使用
+//   rpc_shm_path=/tmp/mprpc.shm    provider的rpc_shm_path
+//   rpc_shm_busy_poll_us=50        等待响应时先忙等的时间，0表示直接在eventfd上等待
+//   rpc_shm_timeout_ms=5000        等待响应的超时
+// 请求头和参数直接序列化到共享内存的请求队列中，provider在原地解析，响应同样直接写在响应队列中，
+// 整个调用没有socket读写。一个channel同一时间只有一个调用在进行，多线程调用时各自使用自己的channel；
+// 不支持流式方法
+class MprpcShmChannel : public google::protobuf::RpcChannel
+{
+public:
+    MprpcShmChannel();
+    ~MprpcShmChannel();
+
+    // 连接配置中的rpc_shm_path
+    bool Connect();
+    bool Connect(const std::string &path);
+
+    // 和path上的provider建立会话，成功时返回会话的unix socket和映射好的共享内存
+    static bool OpenSession(const std::string &path, int *sock, std::unique_ptr<RpcShmSegment> *segment);
+
+    void CallMethod(const google::protobuf::MethodDescriptor *method,
+                    google::protobuf::RpcController *controller, const google::protobuf::Message *request,
+                    google::protobuf::Message *response, google::protobuf::Closure *done);
+
+private:
+    // provider是否已经关闭了会话
+    bool Closed();
+
+    int m_sock;
+    std::unique_ptr<RpcShmSegment> m_segment;
+    std::mutex m_mutex;
+    uint64_t m_nextId;
+    int64_t m_busyPollUs;
+    int m_timeoutMs;
+};
@@ -0,0 +1,99 @@
+#pragma once
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <string>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
+#include "rpcstream.h"
+
+namespace mprpc
+{
+class RpcHeader;
+}
+
+class MprpcStreamChannel;
+struct MprpcStreamConnection;
+
+// 调用方的一个流，由MprpcStreamChannel::OpenStream创建
+//   调用方流(stream Xxx) returns：Write若干次，WritesDone半关闭，Finish取得response
+//   服务端流returns (stream Yyy)：循环Read直到返回false，再用Finish取得最终状态
+//   双向流：读写可以在不同线程中同时进行
+// 不再需要的流用Cancel放弃，没有结束就释放的流同样会取消，provider的处理函数随之结束并让出工作线程
+class MprpcClientStream
+{
+public:
+    ~MprpcClientStream();
+    // 写出一条消息，provider授予的配额用完时阻塞，流已结束或连接断开时返回false
+    bool Write(const google::protobuf::Message &message);
+    // 半关闭：通知provider不会再写消息
+    bool WritesDone();
+    // 读取provider的下一条消息，流结束时返回false
+    bool Read(google::protobuf::Message *message);
+    // 等待流结束，返回RpcStatus，连接错误返回-1；只有调用方流时provider的response解析到response中
+    int Finish(google::protobuf::Message *response = nullptr);
+    // 放弃流：通知provider取消，本地立即结束，阻塞中的Read/Write返回false，Finish返回-1
+    void Cancel();
+    const std::string &ErrorText() const { return m_errorText; }
+    uint64_t Id() const { return m_id; }
+
+private:
+    friend class MprpcStreamChannel;
+    MprpcClientStream(const std::shared_ptr<MprpcStreamConnection> &conn, uint64_t id, uint32_t window);
+    // 经由连接发送一帧，MprpcStreamChannel已经析构时以连接错误结束这个流并返回false
+    bool SendFrame(const mprpc::RpcHeader &header, const std::string &body);
+
+    // 以下由连接的读线程调用
+    void OnMessage(std::string &body);
+    void OnWindow(uint32_t window);
+    void OnEnd(int status, const std::string &error_text, std::string &body);
+
+    std::weak_ptr<MprpcStreamConnection> m_conn; // 流可以比MprpcStreamChannel活得久，只保存弱引用
+    uint64_t m_id;
+    uint32_t m_window;     // 调用方授予provider的配额
+    uint32_t m_sendWindow; // provider授予调用方的剩余配额
+    uint32_t m_consumed;   // 已经读取、还没有归还给provider的消息数
+    std::deque<std::string> m_incoming;
+    bool m_writesDone;
+    bool m_finished;
+    int m_status;
+    std::string m_errorText;
+    std::string m_finalBody;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+};
+
+// 多路复用的流式连接：一条tcp连接上同时进行多个流，每个流有自己的id、消息顺序、半关闭和流控配额，
+// 大批量上传和长期订阅不再需要拆成大量独立的普通调用
+class MprpcStreamChannel
+{
+public:
+    MprpcStreamChannel();
+    ~MprpcStreamChannel();
+
+    // 连接配置中的nginxip:nginxport
+    bool Connect();
+    bool Connect(const std::string &ip, uint16_t port);
+
+    // 在连接上开启一个流，request随开启帧一起发送，可以为空；window为调用方接收方向的配额
+    std::shared_ptr<MprpcClientStream> OpenStream(const google::protobuf::MethodDescriptor *method,
+                                                  const google::protobuf::Message *request = nullptr,
+                                                  uint32_t window = kDefaultStreamWindow);
+
+private:
+    void RemoveStream(uint64_t id);
+    // 读线程：按request_id把provider的帧分发给各个流
+    void ReadLoop();
+
+    std::shared_ptr<MprpcStreamConnection> m_conn; // 连接成功后创建，channel是唯一的长期持有者
+    std::thread m_reader;
+    std::mutex m_streamMutex;
+    // 只保存弱引用，调用方释放流时流的析构函数能够发出取消帧；失效的表项在provider的结束帧到达时删除
+    std::unordered_map<uint64_t, std::weak_ptr<MprpcClientStream>> m_streams;
+    std::atomic<uint64_t> m_nextId;
+    bool m_closed; // 连接已断开，由m_streamMutex保护
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "rpcscheduler.h"
+
+// provider端的准入控制：限制同时处理中的请求数，并按CoDel的思路根据排队延迟提前拒绝请求
+class RpcAdmissionController
+{
+public:
+    RpcAdmissionController();
+
+    // 从配置文件读取阈值，需要在provider启动前调用
+    void Init();
+
+    // 请求开始处理前调用，queue_delay_us为请求从到达到开始处理的排队时间
+    // 返回true表示放行，调用方在请求结束后必须调用Release；返回false表示应当以过载拒绝
+    bool Admit(int64_t queue_delay_us, int64_t now_us, RpcPriority priority);
+    // 只检查并发上限，不提供排队延迟的样本。有工作线程时io线程用它占名额，
+    // 排队延迟在工作线程出队时由Overloaded判断，入队时的延迟接近0，混进窗口最小值会让CoDel永远不触发
+    bool TryAcquire();
+    void Release();
+
+    // CoDel判断：一个观测窗口内的最小排队延迟都超过target，说明队列是持续积压而不是突发
+    // 积压时critical请求照常放行，sheddable请求全部拒绝，其余请求排队超过2倍target才拒绝
+    bool Overloaded(int64_t queue_delay_us, int64_t now_us, RpcPriority priority);
+
+    int InFlight() const { return m_inflight.load(std::memory_order_relaxed); }
+    uint64_t Rejected() const { return m_rejected.load(std::memory_order_relaxed); }
+
+private:
+    int m_maxInflight;       // 允许同时处理的最大请求数，0表示不限制
+    int64_t m_targetUs;      // 可接受的排队延迟，0表示关闭CoDel
+    int64_t m_intervalUs;    // 观测窗口长度
+
+    std::atomic<int> m_inflight{0};
+    std::atomic<uint64_t> m_rejected{0};
+    std::atomic<int64_t> m_intervalEnd{0};    // 当前观测窗口的结束时间
+    std::atomic<int64_t> m_minDelay{INT64_MAX}; // 当前观测窗口内的最小排队延迟
+    std::atomic<bool> m_overloaded{false};      // 上一个观测窗口是否处于积压状态
+};
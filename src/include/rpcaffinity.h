@@ -0,0 +1,44 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+
+// 解析"0-3,8,10-11"形式的cpu列表
+std::vector<int> ParseCpuList(const std::string &list);
+// 查询cpu所在的numa节点，查询失败返回-1
+int NumaNodeOfCpu(int cpu);
+
+// 把框架线程绑定到指定的cpu核心，并把内存分配限制在该核心所在的numa节点上
+// rpc_io_cpus=0-3       io线程依次绑定的核心
+// rpc_worker_cpus=4-7   工作线程依次绑定的核心
+// rpc_numa_local=true   线程的内存优先从所在numa节点分配
+class RpcAffinity
+{
+public:
+    static RpcAffinity &GetInstance();
+
+    // 在线程启动时调用，按角色(io/worker)依次选取配置的核心进行绑定，并记录下来用于启动报告
+    void BindCurrentThread(const std::string &role);
+    // 输出线程与核心、numa节点的对应关系
+    void Report();
+
+private:
+    struct ThreadEntry
+    {
+        std::string name;
+        int tid;
+        int cpu;  // -1表示没有绑定
+        int node;
+    };
+
+    std::unordered_map<std::string, std::vector<int>> m_cpus; // 每种角色可用的核心
+    std::unordered_map<std::string, int> m_nextIndex;         // 每种角色下一个线程的序号
+    bool m_numaLocal;
+    std::vector<ThreadEntry> m_layout;
+    std::mutex m_mutex;
+
+    RpcAffinity();
+    RpcAffinity(const RpcAffinity &) = delete;
+    RpcAffinity(RpcAffinity &&) = delete;
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include "mprpccontroller.h"
+#include <google/protobuf/message.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// 引用输入数据的请求解析：请求中不小于阈值的顶层bytes/string字段不复制到请求对象里，
+// 处理函数通过controller直接读取它们在输入数据中的位置，其余字段照常解析到请求对象
+// 按方法配置，例如 FileServiceRpc.Upload.alias_bytes=4096，流式方法不支持
+// 引用的数据只在处理函数返回之前有效，需要更久时由处理函数自己复制
+class RpcAliasController : public MprpcController
+{
+public:
+    // 解析请求，copy_input为true时先把输入整体复制一份再引用，用于输入缓冲区在处理函数返回前就会被回收的情况
+    bool Parse(const char *data, size_t size, size_t min_bytes, bool copy_input, google::protobuf::Message *request);
+
+    // 字段被引用时返回true；返回false表示字段没有出现或者小于阈值，这时直接从请求对象中读取
+    bool AliasedField(int number, const char **data, size_t *size) const;
+
+private:
+    struct AliasedBytes
+    {
+        int number;
+        const char *data;
+        size_t size;
+    };
+    std::vector<AliasedBytes> m_fields;
+    std::string m_input;
+};
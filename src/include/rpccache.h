@@ -0,0 +1,59 @@
+#pragma once
+#include <string>
+#include <list>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+
+// provider端的响应缓存：缓存幂等方法已经序列化好的响应，命中时跳过请求解析、方法执行和响应序列化
+// 键为(方法id, 序列化的请求)，按方法配置TTL，总内存有上限，分片后每个分片独立按LRU淘汰
+//   response_cache_mb=64                            所有分片合计的内存上限
+//   response_cache_shards=16                        分片数，减少io线程之间的锁竞争
+//   FriendServiceRpc.GetFriendList.cache_ttl_ms=500 只有配置了TTL的方法才会缓存
+class RpcResponseCache
+{
+public:
+    RpcResponseCache();
+
+    // 从配置文件读取容量和分片数，需要在provider启动前调用
+    void Init();
+
+    static std::string MakeKey(uint32_t method_id, const char *args, size_t args_size);
+
+    // 命中并且没有过期时把响应复制到response中返回true
+    bool Lookup(const std::string &key, int64_t now_us, std::string *response);
+    void Insert(const std::string &key, const std::string &response, int64_t expire_us);
+
+    uint64_t Hits() const { return m_hits.load(std::memory_order_relaxed); }
+    uint64_t Misses() const { return m_misses.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry
+    {
+        std::string key;
+        std::string response;
+        int64_t expire_us;
+    };
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::list<Entry> lru; // 表头是最近使用的
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+        size_t bytes = 0;
+    };
+
+    Shard &ShardOf(const std::string &key);
+    // 条目占用的内存，包括键、值和容器节点的大致开销
+    static size_t EntryBytes(const Entry &entry) { return entry.key.size() + entry.response.size() + 96; }
+    void Erase(Shard &shard, std::list<Entry>::iterator it);
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+    size_t m_shardCapacity; // 每个分片的内存上限
+
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+};
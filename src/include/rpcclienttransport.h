@@ -0,0 +1,36 @@
+#pragma once
+#include "rpctransport.h"
+
+// 调用方内建的传输，由RpcTransportRegistry按名字登记
+
+// 调用方接收一帧响应的大小上限(rpc_max_frame_bytes，默认64MB)，所有读响应的路径共用
+size_t RpcMaxFrameBytes();
+
+// tcp：每次调用一条阻塞socket连接，endpoint带有unix_path时先尝试unix域socket
+class RpcTcpClientTransport : public RpcClientTransport
+{
+public:
+    std::unique_ptr<RpcClientConnection> Connect(const RpcEndpoint &endpoint,
+                                                 google::protobuf::RpcController *controller) override;
+};
+
+#ifdef MPRPC_WITH_URING
+// uring：每个调用线程一个io_uring和两块注册给内核的固定缓冲区(发送、接收各一块)。
+// 连接、发送请求和第一次接收链接在一起一次提交，读写使用READ_FIXED/WRITE_FIXED；
+// 内核不支持io_uring或者endpoint带有unix_path时使用tcp传输
+class RpcUringClientTransport : public RpcClientTransport
+{
+public:
+    std::unique_ptr<RpcClientConnection> Connect(const RpcEndpoint &endpoint,
+                                                 google::protobuf::RpcController *controller) override;
+};
+#endif
+
+// shm：连接配置中rpc_shm_path的provider，每个调用线程保持一个共享内存会话，不使用endpoint。
+// 请求帧需要从调用方的缓冲区复制一次到共享内存，不需要这层抽象时直接使用MprpcShmChannel
+class RpcShmClientTransport : public RpcClientTransport
+{
+public:
+    std::unique_ptr<RpcClientConnection> Connect(const RpcEndpoint &endpoint,
+                                                 google::protobuf::RpcController *controller) override;
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include "rpcheader.pb.h"
+#include <google/protobuf/descriptor.h>
+#include <string>
+#include <cstdint>
+
+struct RpcDictionary;
+
+// 一个方法的压缩策略：数据不小于min_bytes时用codec压缩，dict非空时用这个zstd字典
+struct RpcCompressPolicy
+{
+    mprpc::RpcCompression codec = mprpc::COMPRESS_NONE;
+    uint32_t min_bytes = 0;
+    uint32_t dict_id = 0;
+    const RpcDictionary *dict = nullptr;
+
+    // provider按调用方声明接受的算法和持有的字典协商：调用方不接受这种算法时不压缩响应，
+    // 调用方没有这个字典时退回不带字典的zstd
+    RpcCompressPolicy Negotiate(uint32_t accept, uint32_t accept_dict_id) const
+    {
+        RpcCompressPolicy policy = *this;
+        if (policy.dict_id != 0 && policy.dict_id != accept_dict_id)
+        {
+            policy.dict_id = 0;
+            policy.dict = nullptr;
+        }
+        if ((accept & (1u << codec)) == 0)
+        {
+            policy.codec = mprpc::COMPRESS_NONE;
+        }
+        return policy;
+    }
+};
+
+// 请求和响应数据的压缩，调用方压缩请求，provider压缩响应，两边都按方法配置
+//   rpc_compress=lz4|zstd|none                           默认的压缩算法，默认不压缩
+//   rpc_compress_min_bytes=1024                          默认的压缩阈值
+//   rpc_compress_zstd_level=1                            zstd的压缩级别
+//   FriendServiceRpc.GetFriendList.compress=zstd         按方法覆盖算法
+//   FriendServiceRpc.GetFriendList.compress_min_bytes=256
+// 调用方在请求头的accept_compression中声明自己能解压的算法，provider只用调用方接受的算法压缩响应；
+// 压缩后没有变小的数据照原样发送。压缩和解压的上下文每个线程一份，不加锁也不重复分配
+//
+// 几百字节以内的小消息单独压缩几乎没有收益，可以给方法配置一个用抓取的流量训练出来的zstd字典，
+// 配置了字典的方法使用zstd，阈值默认降到32字节，字典id随请求头和响应头传递：
+//   UserServiceRpc.Login.compress_dict=/etc/mprpc/Login.dict   从文件加载
+//   rpc_dict_zk_path=/mprpc_dicts                             从zookeeper加载，见下
+//   rpc_dict_capture_dir=/var/tmp/mprpc_samples               调用方把每个方法的请求和响应抓取到
+//   rpc_dict_capture_max=10000                                <目录>/<服务>.<方法>.samples，每个方法最多抓取的条数
+// zookeeper上每个方法的字典是<rpc_dict_zk_path>/<服务>.<方法>下的顺序节点，由dicttrainer发布。
+// 所有版本的字典都加载用于解压，并监听新发布的版本；压缩使用启动时序号最大的版本，
+// 所以发布新字典后已经运行的provider可以立即解压，调用方重启后才开始使用新字典。
+// provider没有请求所用的字典时(字典文件不一致，或者还没有监听到新版本)以RPC_UNKNOWN_DICT拒绝，
+// 调用方不用字典重新压缩后立即重发，并且这个线程在30秒内压缩这个方法的请求都不用字典
+class RpcCompressor
+{
+public:
+    // 本进程能解压的算法掩码
+    static const uint32_t kSupported = (1u << mprpc::COMPRESS_LZ4) | (1u << mprpc::COMPRESS_ZSTD);
+
+    // 从配置读取方法的压缩策略，没有方法级配置时使用默认配置，同时加载方法的字典
+    static RpcCompressPolicy LoadPolicy(const std::string &service_name, const std::string &method_name);
+    // 调用方按方法缓存的压缩策略，每个线程缓存一份
+    static const RpcCompressPolicy &PolicyFor(const google::protobuf::MethodDescriptor *method);
+
+    // 数据达到阈值并且压缩后确实变小时返回true，压缩结果写入out
+    static bool Compress(const RpcCompressPolicy &policy, const char *data, size_t size, std::string *out);
+    // 解压，raw_size为压缩前的大小，dict_id非0时使用这个字典，数据损坏、大小不符或者没有这个字典时返回false
+    static bool Decompress(mprpc::RpcCompression codec, uint32_t dict_id, const char *data, size_t size,
+                           uint32_t raw_size, std::string *out);
+    // 本进程是否加载了这个字典，provider据此区分字典不一致和数据损坏
+    static bool HasDictionary(uint32_t dict_id);
+    // 线程复用的解压缓冲区用完之后调用，超过4MB时释放，一次大消息不会让线程一直占着这块内存
+    static void ReleaseBuffer(std::string *buffer);
+
+    // 登记一个zstd字典，返回字典id，字典无效时返回0。字典登记后不会释放
+    static uint32_t AddDictionary(const std::string &content);
+
+    // 是否配置了rpc_dict_capture_dir
+    static bool Capturing();
+    // 抓取一条未压缩的请求或响应数据，用于离线训练字典
+    static void Capture(const std::string &service_name, const std::string &method_name, const std::string &data);
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <unordered_map>
+
+// 调用方的自适应并发限制：每个方法在每个目标地址上一个并发上限，按观测到的RTT用梯度算法调整，
+// 自动找到provider的处理能力，provider变慢时调用方主动收缩，而不是继续加压把它压垮。
+// 按方法区分，慢方法的RTT不会压低同一地址上其他方法的上限
+//   rpc_client_limit=gradient   开启，默认不限制
+//   rpc_limit_initial=20        初始上限
+//   rpc_limit_min=1             上限的下界
+//   rpc_limit_max=1000          上限的上界
+//   rpc_limit_queue_ms=0        超出上限的调用最多排队等待的时间，0表示直接失败
+// 探测期间并发被临时压到上限的四分之一，超出探测上限但没有超出正常上限的调用最多等4个最小RTT(不超过100ms)，
+// 等不到时照常放行，不会因为探测而失败
+// 梯度：最近的最小RTT是没有排队时的基准，新上限 = 上限 * clamp(1.5 * 最小RTT / 本次RTT, 0.5, 1) + sqrt(上限)，
+// 再和旧上限按0.2平滑：RTT没有变长时上限逐步增长，RTT变长时按比例收缩；provider返回过载、下线或者网络错误时上限乘以0.9
+class RpcConcurrencyLimiter
+{
+public:
+    struct Target;
+
+    static RpcConcurrencyLimiter &GetInstance();
+
+    bool Enabled() const { return m_enabled; }
+
+    // 为发往target(方法和地址)的一次调用取得名额，没有名额并且排队超时时返回nullptr
+    // 返回非空时调用结束后必须调用Release，rtt_us为0表示这次调用不参与RTT采样(例如流式调用)
+    Target *Acquire(const std::string &target);
+    void Release(Target *target, int64_t rtt_us, int status);
+
+    // 当前的并发上限，没有调用过这个目标时返回初始上限
+    int Limit(const std::string &target);
+    uint64_t Rejected() const { return m_rejected.load(std::memory_order_relaxed); }
+
+private:
+    RpcConcurrencyLimiter();
+
+    bool m_enabled;
+    double m_initialLimit;
+    double m_minLimit;
+    double m_maxLimit;
+    int m_queueMs;
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::unique_ptr<Target>> m_targets;
+    std::atomic<uint64_t> m_rejected{0};
+};
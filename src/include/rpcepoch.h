@@ -0,0 +1,29 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// 基于纪元的内存回收：读者在读共享数据期间登记当前纪元，写者替换共享指针之后调用Synchronize，
+// 等所有在替换之前开始的读区间结束，再释放旧数据。
+// 每个线程一个独占缓存行的槽位，读者只写自己的槽位，不加锁也不和其他读者竞争；
+// 线程退出时归还槽位，所以io线程、工作线程和各个传输的线程都可以是读者。读区间应该很短，例如一次哈希表查找
+class RpcEpoch
+{
+public:
+    // 读区间，构造时登记，析构时离开，同一线程中可以嵌套
+    class ReadGuard
+    {
+    public:
+        ReadGuard();
+        ~ReadGuard();
+
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard &operator=(const ReadGuard &) = delete;
+
+    private:
+        bool m_locked; // 槽位用完的线程退回到加锁
+    };
+
+    // 写者：在共享指针替换完成之后调用，返回时之前开始的读区间都已经结束，旧数据可以释放。
+    // 不能在读区间中调用
+    static void Synchronize();
+};
@@ -1,94 +1,194 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: rpcheader.proto
 
-#ifndef PROTOBUF_INCLUDED_rpcheader_2eproto
-#define PROTOBUF_INCLUDED_rpcheader_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_rpcheader_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rpcheader_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_rpcheader_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[1];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_rpcheader_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_rpcheader_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpcheader_2eproto;
 namespace mprpc {
 class RpcHeader;
-class RpcHeaderDefaultTypeInternal;
+struct RpcHeaderDefaultTypeInternal;
 extern RpcHeaderDefaultTypeInternal _RpcHeader_default_instance_;
+class RpcResponseHeader;
+struct RpcResponseHeaderDefaultTypeInternal;
+extern RpcResponseHeaderDefaultTypeInternal _RpcResponseHeader_default_instance_;
 }  // namespace mprpc
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::mprpc::RpcHeader* Arena::CreateMaybeMessage<::mprpc::RpcHeader>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::mprpc::RpcResponseHeader* Arena::CreateMaybeMessage<::mprpc::RpcResponseHeader>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace mprpc {
 
+enum RpcFrameType : int {
+  FRAME_CALL = 0,
+  FRAME_MESSAGE = 1,
+  FRAME_END = 2,
+  FRAME_WINDOW = 3,
+  FRAME_CANCEL = 4,
+  RpcFrameType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RpcFrameType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RpcFrameType_IsValid(int value);
+constexpr RpcFrameType RpcFrameType_MIN = FRAME_CALL;
+constexpr RpcFrameType RpcFrameType_MAX = FRAME_CANCEL;
+constexpr int RpcFrameType_ARRAYSIZE = RpcFrameType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RpcFrameType_descriptor();
+template<typename T>
+inline const std::string& RpcFrameType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RpcFrameType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RpcFrameType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RpcFrameType_descriptor(), enum_t_value);
+}
+inline bool RpcFrameType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RpcFrameType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RpcFrameType>(
+    RpcFrameType_descriptor(), name, value);
+}
+enum RpcCompression : int {
+  COMPRESS_NONE = 0,
+  COMPRESS_LZ4 = 1,
+  COMPRESS_ZSTD = 2,
+  RpcCompression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RpcCompression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RpcCompression_IsValid(int value);
+constexpr RpcCompression RpcCompression_MIN = COMPRESS_NONE;
+constexpr RpcCompression RpcCompression_MAX = COMPRESS_ZSTD;
+constexpr int RpcCompression_ARRAYSIZE = RpcCompression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RpcCompression_descriptor();
+template<typename T>
+inline const std::string& RpcCompression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RpcCompression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RpcCompression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RpcCompression_descriptor(), enum_t_value);
+}
+inline bool RpcCompression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RpcCompression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RpcCompression>(
+    RpcCompression_descriptor(), name, value);
+}
+enum RpcStatus : int {
+  RPC_OK = 0,
+  RPC_NOT_FOUND = 1,
+  RPC_BAD_REQUEST = 2,
+  RPC_INTERNAL = 3,
+  RPC_OVERLOADED = 4,
+  RPC_UNAVAILABLE = 5,
+  RPC_THROTTLED = 6,
+  RPC_UNKNOWN_DICT = 7,
+  RpcStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RpcStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RpcStatus_IsValid(int value);
+constexpr RpcStatus RpcStatus_MIN = RPC_OK;
+constexpr RpcStatus RpcStatus_MAX = RPC_UNKNOWN_DICT;
+constexpr int RpcStatus_ARRAYSIZE = RpcStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RpcStatus_descriptor();
+template<typename T>
+inline const std::string& RpcStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RpcStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RpcStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RpcStatus_descriptor(), enum_t_value);
+}
+inline bool RpcStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RpcStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RpcStatus>(
+    RpcStatus_descriptor(), name, value);
+}
 // ===================================================================
 
-class RpcHeader : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:mprpc.RpcHeader) */ {
+class RpcHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mprpc.RpcHeader) */ {
  public:
-  RpcHeader();
-  virtual ~RpcHeader();
+  inline RpcHeader() : RpcHeader(nullptr) {}
+  ~RpcHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RpcHeader(const RpcHeader& from);
-
-  inline RpcHeader& operator=(const RpcHeader& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RpcHeader(RpcHeader&& from) noexcept
     : RpcHeader() {
     *this = ::std::move(from);
   }
 
+  inline RpcHeader& operator=(const RpcHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RpcHeader& operator=(RpcHeader&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RpcHeader& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcHeader& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RpcHeader* internal_default_instance() {
     return reinterpret_cast<const RpcHeader*>(
                &_RpcHeader_default_instance_);
@@ -96,99 +196,478 @@ class RpcHeader : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(RpcHeader* other);
   friend void swap(RpcHeader& a, RpcHeader& b) {
     a.Swap(&b);
   }
+  inline void Swap(RpcHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RpcHeader* New() const final {
-    return CreateMaybeMessage<RpcHeader>(NULL);
-  }
-
-  RpcHeader* New(::google::protobuf::Arena* arena) const final {
+  RpcHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RpcHeader>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RpcHeader& from);
-  void MergeFrom(const RpcHeader& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcHeader& from) {
+    RpcHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RpcHeader* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mprpc.RpcHeader";
   }
+  protected:
+  explicit RpcHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kServiceNameFieldNumber = 1,
+    kMethodNameFieldNumber = 2,
+    kClientIdFieldNumber = 7,
+    kRequestIdFieldNumber = 4,
+    kArgSizeFieldNumber = 3,
+    kFrameTypeFieldNumber = 5,
+    kWindowFieldNumber = 6,
+    kCompressionFieldNumber = 8,
+    kRawSizeFieldNumber = 9,
+    kAcceptCompressionFieldNumber = 10,
+    kDictIdFieldNumber = 11,
+    kAcceptDictIdFieldNumber = 12,
+  };
   // bytes service_name = 1;
   void clear_service_name();
-  static const int kServiceNameFieldNumber = 1;
-  const ::std::string& service_name() const;
-  void set_service_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_service_name(::std::string&& value);
-  #endif
-  void set_service_name(const char* value);
-  void set_service_name(const void* value, size_t size);
-  ::std::string* mutable_service_name();
-  ::std::string* release_service_name();
-  void set_allocated_service_name(::std::string* service_name);
+  const std::string& service_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
+  private:
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
+  public:
 
   // bytes method_name = 2;
   void clear_method_name();
-  static const int kMethodNameFieldNumber = 2;
-  const ::std::string& method_name() const;
-  void set_method_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_method_name(::std::string&& value);
-  #endif
-  void set_method_name(const char* value);
-  void set_method_name(const void* value, size_t size);
-  ::std::string* mutable_method_name();
-  ::std::string* release_method_name();
-  void set_allocated_method_name(::std::string* method_name);
+  const std::string& method_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method_name();
+  PROTOBUF_NODISCARD std::string* release_method_name();
+  void set_allocated_method_name(std::string* method_name);
+  private:
+  const std::string& _internal_method_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method_name(const std::string& value);
+  std::string* _internal_mutable_method_name();
+  public:
+
+  // bytes client_id = 7;
+  void clear_client_id();
+  const std::string& client_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_client_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_client_id();
+  PROTOBUF_NODISCARD std::string* release_client_id();
+  void set_allocated_client_id(std::string* client_id);
+  private:
+  const std::string& _internal_client_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_id(const std::string& value);
+  std::string* _internal_mutable_client_id();
+  public:
+
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
 
   // uint32 arg_size = 3;
   void clear_arg_size();
-  static const int kArgSizeFieldNumber = 3;
-  ::google::protobuf::uint32 arg_size() const;
-  void set_arg_size(::google::protobuf::uint32 value);
+  uint32_t arg_size() const;
+  void set_arg_size(uint32_t value);
+  private:
+  uint32_t _internal_arg_size() const;
+  void _internal_set_arg_size(uint32_t value);
+  public:
+
+  // .mprpc.RpcFrameType frame_type = 5;
+  void clear_frame_type();
+  ::mprpc::RpcFrameType frame_type() const;
+  void set_frame_type(::mprpc::RpcFrameType value);
+  private:
+  ::mprpc::RpcFrameType _internal_frame_type() const;
+  void _internal_set_frame_type(::mprpc::RpcFrameType value);
+  public:
+
+  // uint32 window = 6;
+  void clear_window();
+  uint32_t window() const;
+  void set_window(uint32_t value);
+  private:
+  uint32_t _internal_window() const;
+  void _internal_set_window(uint32_t value);
+  public:
+
+  // .mprpc.RpcCompression compression = 8;
+  void clear_compression();
+  ::mprpc::RpcCompression compression() const;
+  void set_compression(::mprpc::RpcCompression value);
+  private:
+  ::mprpc::RpcCompression _internal_compression() const;
+  void _internal_set_compression(::mprpc::RpcCompression value);
+  public:
+
+  // uint32 raw_size = 9;
+  void clear_raw_size();
+  uint32_t raw_size() const;
+  void set_raw_size(uint32_t value);
+  private:
+  uint32_t _internal_raw_size() const;
+  void _internal_set_raw_size(uint32_t value);
+  public:
+
+  // uint32 accept_compression = 10;
+  void clear_accept_compression();
+  uint32_t accept_compression() const;
+  void set_accept_compression(uint32_t value);
+  private:
+  uint32_t _internal_accept_compression() const;
+  void _internal_set_accept_compression(uint32_t value);
+  public:
+
+  // uint32 dict_id = 11;
+  void clear_dict_id();
+  uint32_t dict_id() const;
+  void set_dict_id(uint32_t value);
+  private:
+  uint32_t _internal_dict_id() const;
+  void _internal_set_dict_id(uint32_t value);
+  public:
+
+  // uint32 accept_dict_id = 12;
+  void clear_accept_dict_id();
+  uint32_t accept_dict_id() const;
+  void set_accept_dict_id(uint32_t value);
+  private:
+  uint32_t _internal_accept_dict_id() const;
+  void _internal_set_accept_dict_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:mprpc.RpcHeader)
  private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_id_;
+    uint64_t request_id_;
+    uint32_t arg_size_;
+    int frame_type_;
+    uint32_t window_;
+    int compression_;
+    uint32_t raw_size_;
+    uint32_t accept_compression_;
+    uint32_t dict_id_;
+    uint32_t accept_dict_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RpcResponseHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mprpc.RpcResponseHeader) */ {
+ public:
+  inline RpcResponseHeader() : RpcResponseHeader(nullptr) {}
+  ~RpcResponseHeader() override;
+  explicit PROTOBUF_CONSTEXPR RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcResponseHeader(const RpcResponseHeader& from);
+  RpcResponseHeader(RpcResponseHeader&& from) noexcept
+    : RpcResponseHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcResponseHeader& operator=(const RpcResponseHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcResponseHeader& operator=(RpcResponseHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcResponseHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcResponseHeader* internal_default_instance() {
+    return reinterpret_cast<const RpcResponseHeader*>(
+               &_RpcResponseHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RpcResponseHeader& a, RpcResponseHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcResponseHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcResponseHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcResponseHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcResponseHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcResponseHeader& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcResponseHeader& from) {
+    RpcResponseHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcResponseHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mprpc.RpcResponseHeader";
+  }
+  protected:
+  explicit RpcResponseHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorTextFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kBodySizeFieldNumber = 3,
+    kRequestIdFieldNumber = 4,
+    kFrameTypeFieldNumber = 5,
+    kWindowFieldNumber = 6,
+    kCompressionFieldNumber = 7,
+    kRawSizeFieldNumber = 8,
+    kDictIdFieldNumber = 9,
+  };
+  // bytes error_text = 2;
+  void clear_error_text();
+  const std::string& error_text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_text();
+  PROTOBUF_NODISCARD std::string* release_error_text();
+  void set_allocated_error_text(std::string* error_text);
+  private:
+  const std::string& _internal_error_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_text(const std::string& value);
+  std::string* _internal_mutable_error_text();
+  public:
+
+  // .mprpc.RpcStatus status = 1;
+  void clear_status();
+  ::mprpc::RpcStatus status() const;
+  void set_status(::mprpc::RpcStatus value);
+  private:
+  ::mprpc::RpcStatus _internal_status() const;
+  void _internal_set_status(::mprpc::RpcStatus value);
+  public:
+
+  // uint32 body_size = 3;
+  void clear_body_size();
+  uint32_t body_size() const;
+  void set_body_size(uint32_t value);
+  private:
+  uint32_t _internal_body_size() const;
+  void _internal_set_body_size(uint32_t value);
+  public:
+
+  // uint64 request_id = 4;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // .mprpc.RpcFrameType frame_type = 5;
+  void clear_frame_type();
+  ::mprpc::RpcFrameType frame_type() const;
+  void set_frame_type(::mprpc::RpcFrameType value);
+  private:
+  ::mprpc::RpcFrameType _internal_frame_type() const;
+  void _internal_set_frame_type(::mprpc::RpcFrameType value);
+  public:
+
+  // uint32 window = 6;
+  void clear_window();
+  uint32_t window() const;
+  void set_window(uint32_t value);
+  private:
+  uint32_t _internal_window() const;
+  void _internal_set_window(uint32_t value);
+  public:
+
+  // .mprpc.RpcCompression compression = 7;
+  void clear_compression();
+  ::mprpc::RpcCompression compression() const;
+  void set_compression(::mprpc::RpcCompression value);
+  private:
+  ::mprpc::RpcCompression _internal_compression() const;
+  void _internal_set_compression(::mprpc::RpcCompression value);
+  public:
+
+  // uint32 raw_size = 8;
+  void clear_raw_size();
+  uint32_t raw_size() const;
+  void set_raw_size(uint32_t value);
+  private:
+  uint32_t _internal_raw_size() const;
+  void _internal_set_raw_size(uint32_t value);
+  public:
+
+  // uint32 dict_id = 9;
+  void clear_dict_id();
+  uint32_t dict_id() const;
+  void set_dict_id(uint32_t value);
+  private:
+  uint32_t _internal_dict_id() const;
+  void _internal_set_dict_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mprpc.RpcResponseHeader)
+ private:
+  class _Internal;
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr service_name_;
-  ::google::protobuf::internal::ArenaStringPtr method_name_;
-  ::google::protobuf::uint32 arg_size_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_rpcheader_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_text_;
+    int status_;
+    uint32_t body_size_;
+    uint64_t request_id_;
+    int frame_type_;
+    uint32_t window_;
+    int compression_;
+    uint32_t raw_size_;
+    uint32_t dict_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpcheader_2eproto;
 };
 // ===================================================================
 
@@ -203,132 +682,579 @@ class RpcHeader : public ::google::protobuf::Message /* @@protoc_insertion_point
 
 // bytes service_name = 1;
 inline void RpcHeader::clear_service_name() {
-  service_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.service_name_.ClearToEmpty();
 }
-inline const ::std::string& RpcHeader::service_name() const {
+inline const std::string& RpcHeader::service_name() const {
   // @@protoc_insertion_point(field_get:mprpc.RpcHeader.service_name)
-  return service_name_.GetNoArena();
+  return _internal_service_name();
 }
-inline void RpcHeader::set_service_name(const ::std::string& value) {
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_service_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.service_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:mprpc.RpcHeader.service_name)
 }
-#if LANG_CXX11
-inline void RpcHeader::set_service_name(::std::string&& value) {
-  
-  service_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mprpc.RpcHeader.service_name)
+inline std::string* RpcHeader::mutable_service_name() {
+  std::string* _s = _internal_mutable_service_name();
+  // @@protoc_insertion_point(field_mutable:mprpc.RpcHeader.service_name)
+  return _s;
 }
-#endif
-inline void RpcHeader::set_service_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mprpc.RpcHeader.service_name)
+inline const std::string& RpcHeader::_internal_service_name() const {
+  return _impl_.service_name_.Get();
 }
-inline void RpcHeader::set_service_name(const void* value, size_t size) {
+inline void RpcHeader::_internal_set_service_name(const std::string& value) {
   
-  service_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mprpc.RpcHeader.service_name)
+  _impl_.service_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::mutable_service_name() {
+inline std::string* RpcHeader::_internal_mutable_service_name() {
   
-  // @@protoc_insertion_point(field_mutable:mprpc.RpcHeader.service_name)
-  return service_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.service_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::release_service_name() {
+inline std::string* RpcHeader::release_service_name() {
   // @@protoc_insertion_point(field_release:mprpc.RpcHeader.service_name)
-  
-  return service_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.service_name_.Release();
 }
-inline void RpcHeader::set_allocated_service_name(::std::string* service_name) {
-  if (service_name != NULL) {
+inline void RpcHeader::set_allocated_service_name(std::string* service_name) {
+  if (service_name != nullptr) {
     
   } else {
     
   }
-  service_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), service_name);
+  _impl_.service_name_.SetAllocated(service_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_name_.IsDefault()) {
+    _impl_.service_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:mprpc.RpcHeader.service_name)
 }
 
 // bytes method_name = 2;
 inline void RpcHeader::clear_method_name() {
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.method_name_.ClearToEmpty();
 }
-inline const ::std::string& RpcHeader::method_name() const {
+inline const std::string& RpcHeader::method_name() const {
   // @@protoc_insertion_point(field_get:mprpc.RpcHeader.method_name)
-  return method_name_.GetNoArena();
+  return _internal_method_name();
 }
-inline void RpcHeader::set_method_name(const ::std::string& value) {
-  
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_method_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.method_name_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:mprpc.RpcHeader.method_name)
 }
-#if LANG_CXX11
-inline void RpcHeader::set_method_name(::std::string&& value) {
-  
-  method_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mprpc.RpcHeader.method_name)
+inline std::string* RpcHeader::mutable_method_name() {
+  std::string* _s = _internal_mutable_method_name();
+  // @@protoc_insertion_point(field_mutable:mprpc.RpcHeader.method_name)
+  return _s;
 }
-#endif
-inline void RpcHeader::set_method_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mprpc.RpcHeader.method_name)
+inline const std::string& RpcHeader::_internal_method_name() const {
+  return _impl_.method_name_.Get();
 }
-inline void RpcHeader::set_method_name(const void* value, size_t size) {
+inline void RpcHeader::_internal_set_method_name(const std::string& value) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mprpc.RpcHeader.method_name)
+  _impl_.method_name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::mutable_method_name() {
+inline std::string* RpcHeader::_internal_mutable_method_name() {
   
-  // @@protoc_insertion_point(field_mutable:mprpc.RpcHeader.method_name)
-  return method_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.method_name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RpcHeader::release_method_name() {
+inline std::string* RpcHeader::release_method_name() {
   // @@protoc_insertion_point(field_release:mprpc.RpcHeader.method_name)
-  
-  return method_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.method_name_.Release();
 }
-inline void RpcHeader::set_allocated_method_name(::std::string* method_name) {
-  if (method_name != NULL) {
+inline void RpcHeader::set_allocated_method_name(std::string* method_name) {
+  if (method_name != nullptr) {
     
   } else {
     
   }
-  method_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name);
+  _impl_.method_name_.SetAllocated(method_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_name_.IsDefault()) {
+    _impl_.method_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:mprpc.RpcHeader.method_name)
 }
 
 // uint32 arg_size = 3;
 inline void RpcHeader::clear_arg_size() {
-  arg_size_ = 0u;
+  _impl_.arg_size_ = 0u;
 }
-inline ::google::protobuf::uint32 RpcHeader::arg_size() const {
+inline uint32_t RpcHeader::_internal_arg_size() const {
+  return _impl_.arg_size_;
+}
+inline uint32_t RpcHeader::arg_size() const {
   // @@protoc_insertion_point(field_get:mprpc.RpcHeader.arg_size)
-  return arg_size_;
+  return _internal_arg_size();
 }
-inline void RpcHeader::set_arg_size(::google::protobuf::uint32 value) {
+inline void RpcHeader::_internal_set_arg_size(uint32_t value) {
   
-  arg_size_ = value;
+  _impl_.arg_size_ = value;
+}
+inline void RpcHeader::set_arg_size(uint32_t value) {
+  _internal_set_arg_size(value);
   // @@protoc_insertion_point(field_set:mprpc.RpcHeader.arg_size)
 }
 
+// uint64 request_id = 4;
+inline void RpcHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void RpcHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.request_id)
+}
+
+// .mprpc.RpcFrameType frame_type = 5;
+inline void RpcHeader::clear_frame_type() {
+  _impl_.frame_type_ = 0;
+}
+inline ::mprpc::RpcFrameType RpcHeader::_internal_frame_type() const {
+  return static_cast< ::mprpc::RpcFrameType >(_impl_.frame_type_);
+}
+inline ::mprpc::RpcFrameType RpcHeader::frame_type() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.frame_type)
+  return _internal_frame_type();
+}
+inline void RpcHeader::_internal_set_frame_type(::mprpc::RpcFrameType value) {
+  
+  _impl_.frame_type_ = value;
+}
+inline void RpcHeader::set_frame_type(::mprpc::RpcFrameType value) {
+  _internal_set_frame_type(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.frame_type)
+}
+
+// uint32 window = 6;
+inline void RpcHeader::clear_window() {
+  _impl_.window_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_window() const {
+  return _impl_.window_;
+}
+inline uint32_t RpcHeader::window() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.window)
+  return _internal_window();
+}
+inline void RpcHeader::_internal_set_window(uint32_t value) {
+  
+  _impl_.window_ = value;
+}
+inline void RpcHeader::set_window(uint32_t value) {
+  _internal_set_window(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.window)
+}
+
+// bytes client_id = 7;
+inline void RpcHeader::clear_client_id() {
+  _impl_.client_id_.ClearToEmpty();
+}
+inline const std::string& RpcHeader::client_id() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.client_id)
+  return _internal_client_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcHeader::set_client_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.client_id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.client_id)
+}
+inline std::string* RpcHeader::mutable_client_id() {
+  std::string* _s = _internal_mutable_client_id();
+  // @@protoc_insertion_point(field_mutable:mprpc.RpcHeader.client_id)
+  return _s;
+}
+inline const std::string& RpcHeader::_internal_client_id() const {
+  return _impl_.client_id_.Get();
+}
+inline void RpcHeader::_internal_set_client_id(const std::string& value) {
+  
+  _impl_.client_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcHeader::_internal_mutable_client_id() {
+  
+  return _impl_.client_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcHeader::release_client_id() {
+  // @@protoc_insertion_point(field_release:mprpc.RpcHeader.client_id)
+  return _impl_.client_id_.Release();
+}
+inline void RpcHeader::set_allocated_client_id(std::string* client_id) {
+  if (client_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.client_id_.SetAllocated(client_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.client_id_.IsDefault()) {
+    _impl_.client_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mprpc.RpcHeader.client_id)
+}
+
+// .mprpc.RpcCompression compression = 8;
+inline void RpcHeader::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::mprpc::RpcCompression RpcHeader::_internal_compression() const {
+  return static_cast< ::mprpc::RpcCompression >(_impl_.compression_);
+}
+inline ::mprpc::RpcCompression RpcHeader::compression() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.compression)
+  return _internal_compression();
+}
+inline void RpcHeader::_internal_set_compression(::mprpc::RpcCompression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void RpcHeader::set_compression(::mprpc::RpcCompression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.compression)
+}
+
+// uint32 raw_size = 9;
+inline void RpcHeader::clear_raw_size() {
+  _impl_.raw_size_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_raw_size() const {
+  return _impl_.raw_size_;
+}
+inline uint32_t RpcHeader::raw_size() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.raw_size)
+  return _internal_raw_size();
+}
+inline void RpcHeader::_internal_set_raw_size(uint32_t value) {
+  
+  _impl_.raw_size_ = value;
+}
+inline void RpcHeader::set_raw_size(uint32_t value) {
+  _internal_set_raw_size(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.raw_size)
+}
+
+// uint32 accept_compression = 10;
+inline void RpcHeader::clear_accept_compression() {
+  _impl_.accept_compression_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_accept_compression() const {
+  return _impl_.accept_compression_;
+}
+inline uint32_t RpcHeader::accept_compression() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.accept_compression)
+  return _internal_accept_compression();
+}
+inline void RpcHeader::_internal_set_accept_compression(uint32_t value) {
+  
+  _impl_.accept_compression_ = value;
+}
+inline void RpcHeader::set_accept_compression(uint32_t value) {
+  _internal_set_accept_compression(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.accept_compression)
+}
+
+// uint32 dict_id = 11;
+inline void RpcHeader::clear_dict_id() {
+  _impl_.dict_id_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_dict_id() const {
+  return _impl_.dict_id_;
+}
+inline uint32_t RpcHeader::dict_id() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.dict_id)
+  return _internal_dict_id();
+}
+inline void RpcHeader::_internal_set_dict_id(uint32_t value) {
+  
+  _impl_.dict_id_ = value;
+}
+inline void RpcHeader::set_dict_id(uint32_t value) {
+  _internal_set_dict_id(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.dict_id)
+}
+
+// uint32 accept_dict_id = 12;
+inline void RpcHeader::clear_accept_dict_id() {
+  _impl_.accept_dict_id_ = 0u;
+}
+inline uint32_t RpcHeader::_internal_accept_dict_id() const {
+  return _impl_.accept_dict_id_;
+}
+inline uint32_t RpcHeader::accept_dict_id() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcHeader.accept_dict_id)
+  return _internal_accept_dict_id();
+}
+inline void RpcHeader::_internal_set_accept_dict_id(uint32_t value) {
+  
+  _impl_.accept_dict_id_ = value;
+}
+inline void RpcHeader::set_accept_dict_id(uint32_t value) {
+  _internal_set_accept_dict_id(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcHeader.accept_dict_id)
+}
+
+// -------------------------------------------------------------------
+
+// RpcResponseHeader
+
+// .mprpc.RpcStatus status = 1;
+inline void RpcResponseHeader::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::mprpc::RpcStatus RpcResponseHeader::_internal_status() const {
+  return static_cast< ::mprpc::RpcStatus >(_impl_.status_);
+}
+inline ::mprpc::RpcStatus RpcResponseHeader::status() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.status)
+  return _internal_status();
+}
+inline void RpcResponseHeader::_internal_set_status(::mprpc::RpcStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void RpcResponseHeader::set_status(::mprpc::RpcStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.status)
+}
+
+// bytes error_text = 2;
+inline void RpcResponseHeader::clear_error_text() {
+  _impl_.error_text_.ClearToEmpty();
+}
+inline const std::string& RpcResponseHeader::error_text() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.error_text)
+  return _internal_error_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcResponseHeader::set_error_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_text_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.error_text)
+}
+inline std::string* RpcResponseHeader::mutable_error_text() {
+  std::string* _s = _internal_mutable_error_text();
+  // @@protoc_insertion_point(field_mutable:mprpc.RpcResponseHeader.error_text)
+  return _s;
+}
+inline const std::string& RpcResponseHeader::_internal_error_text() const {
+  return _impl_.error_text_.Get();
+}
+inline void RpcResponseHeader::_internal_set_error_text(const std::string& value) {
+  
+  _impl_.error_text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::_internal_mutable_error_text() {
+  
+  return _impl_.error_text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcResponseHeader::release_error_text() {
+  // @@protoc_insertion_point(field_release:mprpc.RpcResponseHeader.error_text)
+  return _impl_.error_text_.Release();
+}
+inline void RpcResponseHeader::set_allocated_error_text(std::string* error_text) {
+  if (error_text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_text_.SetAllocated(error_text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_text_.IsDefault()) {
+    _impl_.error_text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mprpc.RpcResponseHeader.error_text)
+}
+
+// uint32 body_size = 3;
+inline void RpcResponseHeader::clear_body_size() {
+  _impl_.body_size_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_body_size() const {
+  return _impl_.body_size_;
+}
+inline uint32_t RpcResponseHeader::body_size() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.body_size)
+  return _internal_body_size();
+}
+inline void RpcResponseHeader::_internal_set_body_size(uint32_t value) {
+  
+  _impl_.body_size_ = value;
+}
+inline void RpcResponseHeader::set_body_size(uint32_t value) {
+  _internal_set_body_size(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.body_size)
+}
+
+// uint64 request_id = 4;
+inline void RpcResponseHeader::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t RpcResponseHeader::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t RpcResponseHeader::request_id() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.request_id)
+  return _internal_request_id();
+}
+inline void RpcResponseHeader::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void RpcResponseHeader::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.request_id)
+}
+
+// .mprpc.RpcFrameType frame_type = 5;
+inline void RpcResponseHeader::clear_frame_type() {
+  _impl_.frame_type_ = 0;
+}
+inline ::mprpc::RpcFrameType RpcResponseHeader::_internal_frame_type() const {
+  return static_cast< ::mprpc::RpcFrameType >(_impl_.frame_type_);
+}
+inline ::mprpc::RpcFrameType RpcResponseHeader::frame_type() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.frame_type)
+  return _internal_frame_type();
+}
+inline void RpcResponseHeader::_internal_set_frame_type(::mprpc::RpcFrameType value) {
+  
+  _impl_.frame_type_ = value;
+}
+inline void RpcResponseHeader::set_frame_type(::mprpc::RpcFrameType value) {
+  _internal_set_frame_type(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.frame_type)
+}
+
+// uint32 window = 6;
+inline void RpcResponseHeader::clear_window() {
+  _impl_.window_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_window() const {
+  return _impl_.window_;
+}
+inline uint32_t RpcResponseHeader::window() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.window)
+  return _internal_window();
+}
+inline void RpcResponseHeader::_internal_set_window(uint32_t value) {
+  
+  _impl_.window_ = value;
+}
+inline void RpcResponseHeader::set_window(uint32_t value) {
+  _internal_set_window(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.window)
+}
+
+// .mprpc.RpcCompression compression = 7;
+inline void RpcResponseHeader::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::mprpc::RpcCompression RpcResponseHeader::_internal_compression() const {
+  return static_cast< ::mprpc::RpcCompression >(_impl_.compression_);
+}
+inline ::mprpc::RpcCompression RpcResponseHeader::compression() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.compression)
+  return _internal_compression();
+}
+inline void RpcResponseHeader::_internal_set_compression(::mprpc::RpcCompression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void RpcResponseHeader::set_compression(::mprpc::RpcCompression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.compression)
+}
+
+// uint32 raw_size = 8;
+inline void RpcResponseHeader::clear_raw_size() {
+  _impl_.raw_size_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_raw_size() const {
+  return _impl_.raw_size_;
+}
+inline uint32_t RpcResponseHeader::raw_size() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.raw_size)
+  return _internal_raw_size();
+}
+inline void RpcResponseHeader::_internal_set_raw_size(uint32_t value) {
+  
+  _impl_.raw_size_ = value;
+}
+inline void RpcResponseHeader::set_raw_size(uint32_t value) {
+  _internal_set_raw_size(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.raw_size)
+}
+
+// uint32 dict_id = 9;
+inline void RpcResponseHeader::clear_dict_id() {
+  _impl_.dict_id_ = 0u;
+}
+inline uint32_t RpcResponseHeader::_internal_dict_id() const {
+  return _impl_.dict_id_;
+}
+inline uint32_t RpcResponseHeader::dict_id() const {
+  // @@protoc_insertion_point(field_get:mprpc.RpcResponseHeader.dict_id)
+  return _internal_dict_id();
+}
+inline void RpcResponseHeader::_internal_set_dict_id(uint32_t value) {
+  
+  _impl_.dict_id_ = value;
+}
+inline void RpcResponseHeader::set_dict_id(uint32_t value) {
+  _internal_set_dict_id(value);
+  // @@protoc_insertion_point(field_set:mprpc.RpcResponseHeader.dict_id)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace mprpc
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::mprpc::RpcFrameType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mprpc::RpcFrameType>() {
+  return ::mprpc::RpcFrameType_descriptor();
+}
+template <> struct is_proto_enum< ::mprpc::RpcCompression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mprpc::RpcCompression>() {
+  return ::mprpc::RpcCompression_descriptor();
+}
+template <> struct is_proto_enum< ::mprpc::RpcStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mprpc::RpcStatus>() {
+  return ::mprpc::RpcStatus_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_rpcheader_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpcheader_2eproto
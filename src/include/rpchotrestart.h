@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+
+// 热重启时新旧provider进程之间的交接协议，走unix socket，socket通过SCM_RIGHTS随消息传递
+//   新进程 -> 旧进程  kTakeListener       请求监听socket
+//   旧进程 -> 新进程  kListener + fd      旧进程交出监听socket后停止accept
+//   新进程 -> 旧进程  kReady              新进程已经在zookeeper上注册，旧进程可以注销并开始下线
+//   旧进程 -> 新进程  kConnection + fd    交出一个空闲的连接，数据为旧进程读到但没有处理的请求
+//   旧进程 -> 新进程  kDone               交接结束
+// 共享内存传输建立会话时也用这套消息传递memfd和eventfd(见RpcShmServer)
+// 每条消息为1字节类型 + 4字节数据长度 + 数据
+class RpcHotRestart
+{
+public:
+    enum MessageType : char
+    {
+        kTakeListener = 'T',
+        kListener = 'L',
+        kReady = 'R',
+        kConnection = 'C',
+        kDone = 'D',
+        kShmSegment = 'M',
+        kShmEvent = 'E',
+    };
+
+    // 旧进程：在path上监听交接请求，path上残留的socket文件会先删除，失败返回-1
+    static int Listen(const std::string &path);
+    // 新进程：连接正在运行的旧进程，没有旧进程时返回-1
+    static int Connect(const std::string &path);
+
+    // 阻塞地收发一条消息，fd为-1表示不附带socket；接收时没有附带socket则*fd为-1
+    static bool Send(int sock, MessageType type, const std::string &data, int fd = -1);
+    static bool Recv(int sock, MessageType *type, std::string *data, int *fd);
+};
@@ -0,0 +1,58 @@
+#pragma once
+#include <muduo/net/EventLoop.h>
+#include <muduo/net/EventLoopThreadPool.h>
+#include <muduo/net/TcpConnection.h>
+#include <muduo/net/Channel.h>
+#include <muduo/net/InetAddress.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+
+// 自己管理监听socket的TcpServer替代品，热重启时使用：监听socket可以从旧进程继承，
+// 旧进程的已建立连接也可以直接接管。新连接按轮询分给io线程池，没有线程池时留在loop所在线程
+// 除了构造之外的接口都需要在loop线程中调用
+class RpcListener : muduo::noncopyable
+{
+public:
+    RpcListener(muduo::net::EventLoop *loop, int listen_fd, muduo::net::EventLoopThreadPool *pool);
+    ~RpcListener();
+
+    // 创建非阻塞的监听socket，绑定并开始监听，失败返回-1
+    static int Listen(const muduo::net::InetAddress &address);
+    // 在unix域socket路径上监听，路径上残留的socket文件会先删除
+    static int ListenUnix(const std::string &path);
+
+    void SetConnectionCallback(const muduo::net::ConnectionCallback &cb) { m_connectionCallback = cb; }
+    void SetMessageCallback(const muduo::net::MessageCallback &cb) { m_messageCallback = cb; }
+
+    void Start();
+    // 停止accept，监听socket交给新进程后由新进程继续accept
+    void StopAccepting();
+    // 接管一个已建立的连接，initial为旧进程已经读到但还没有处理的数据
+    void Adopt(int fd, const std::string &initial);
+
+    int ListenFd() const { return m_listenFd; }
+    // 当前的所有连接和它们的socket
+    std::vector<std::pair<muduo::net::TcpConnectionPtr, int>> Connections() const;
+
+private:
+    struct Connection
+    {
+        muduo::net::TcpConnectionPtr conn;
+        int fd;
+    };
+
+    void HandleRead();
+    void NewConnection(int fd, const std::string &initial);
+    void RemoveConnection(const muduo::net::TcpConnectionPtr &conn);
+
+    muduo::net::EventLoop *m_loop;
+    muduo::net::EventLoopThreadPool *m_pool;
+    int m_listenFd;
+    muduo::net::Channel m_channel;
+    int m_nextConnId;
+    std::map<std::string, Connection> m_connections; // 按连接名索引，只在loop线程中访问
+    muduo::net::ConnectionCallback m_connectionCallback;
+    muduo::net::MessageCallback m_messageCallback;
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <google/protobuf/service.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// 进程内的服务表：RpcProvider发布服务时登记，MprpcChannel调用同一进程中发布的服务时直接执行，
+// 不经过序列化、socket和nginx
+//   rpc_local_calls=false       关闭进程内直连，全部走网络
+//   rpc_local_isolation=true    请求和响应各复制一份到arena上再交给服务，双方不共享消息对象
+// 直连调用不经过provider的限流、准入和线程池，也不计入provider的指标；流式方法以及开启了
+// 引用解析的方法仍然走网络
+class RpcLocalRegistry
+{
+public:
+    static RpcLocalRegistry &GetInstance();
+
+    // owner在直连调用期间一直被持有，服务注销后等调用结束才释放
+    void Add(google::protobuf::Service *service, std::shared_ptr<void> owner,
+             const std::vector<const google::protobuf::MethodDescriptor *> &methods);
+    // 只删除由这个服务对象登记的表项，同类型的服务被其他provider重新登记过时不影响它
+    void Remove(google::protobuf::Service *service);
+
+    // 方法由本进程发布时直接调用并返回true，调用在方法完成(done被执行)之后才返回；返回false表示需要走网络
+    bool Call(const google::protobuf::MethodDescriptor *method, google::protobuf::RpcController *controller,
+              const google::protobuf::Message *request, google::protobuf::Message *response);
+
+private:
+    RpcLocalRegistry();
+
+    struct Entry
+    {
+        google::protobuf::Service *service;
+        std::shared_ptr<void> owner;
+        std::unordered_set<const google::protobuf::MethodDescriptor *> methods;
+    };
+    // 生成代码中的描述符在进程内唯一，直接用指针做键
+    std::unordered_map<const google::protobuf::ServiceDescriptor *, Entry> m_services;
+    std::mutex m_mutex;
+    bool m_enabled;
+    bool m_isolation;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+// provider端按服务和方法统计的指标，以Prometheus文本格式输出
+// 每个线程第一次记录时分配自己的计数分片，之后只有这个线程写它，记录时没有锁也没有原子读改写；
+// 抓取时把所有分片累加起来。线程退出时分片的计数并入一个退役分片，分片清零后留给之后的新线程，
+// 所以分片数不超过同时记录过的线程数，shm会话线程这类反复创建的线程不会让内存和抓取开销一直增长
+class RpcMetrics
+{
+public:
+    // 方法编号的上限，超出的方法不统计
+    static const uint32_t kMaxMethods = 1024;
+    // 找不到服务或方法的请求记在这个编号下
+    static const uint32_t kUnknownMethod = kMaxMethods - 1;
+
+    RpcMetrics();
+    ~RpcMetrics();
+
+    // 登记方法编号对应的服务名和方法名
+    void AddMethod(uint32_t method_id, const std::string &service_name, const std::string &method_name);
+
+    // 一次调用结束时记录：status为RpcStatus，queue_us为排队时间，handler_us为方法执行时间，
+    // 没有执行方法就被拒绝或者直接从缓存返回的请求queue_us传-1，不计入延迟直方图
+    void Record(uint32_t method_id, int status, int64_t queue_us, int64_t handler_us,
+                uint32_t request_bytes, uint32_t response_bytes);
+
+    // 输出所有方法的计数器和直方图
+    void Render(std::string *out);
+
+private:
+    // 延迟直方图的桶上界(微秒)，最后还有一个+Inf桶
+    static const int kBucketCount = 14;
+    static const int64_t kBucketBoundsUs[kBucketCount];
+    // RpcStatus的取值个数上限
+    static const int kStatusCount = 8;
+
+    struct Histogram
+    {
+        std::atomic<uint64_t> buckets[kBucketCount + 1];
+        std::atomic<uint64_t> sum_us;
+    };
+
+    struct MethodCounters
+    {
+        std::atomic<uint64_t> requests;
+        std::atomic<uint64_t> status[kStatusCount];
+        std::atomic<uint64_t> request_bytes;
+        std::atomic<uint64_t> response_bytes;
+        Histogram queue_time;
+        Histogram handler_time;
+        MethodCounters();
+    };
+
+    // 一个线程的计数分片，方法的计数在第一次记录时分配
+    struct ThreadShard
+    {
+        std::atomic<MethodCounters *> methods[kMaxMethods];
+        ThreadShard();
+    };
+
+    // 线程的分片表，线程退出时析构，归还分片
+    struct LocalShards;
+
+    ThreadShard *LocalShard();
+    // 把退出的线程的分片并入m_retired，清零后放入空闲列表，需要持有m_mutex
+    void RetireShard(ThreadShard *shard);
+    static void Merge(MethodCounters *to, MethodCounters *from);
+    static void Observe(Histogram &histogram, int64_t value_us);
+    void RenderHistogram(std::string *out, const char *name, const std::string &labels,
+                         const std::vector<const Histogram *> &histograms);
+
+    struct MethodName
+    {
+        std::string service;
+        std::string method;
+    };
+    std::vector<MethodName> m_names; // 下标为方法编号，名字为空表示没有登记
+    uint64_t m_id; // 线程的分片表按它区分RpcMetrics对象，对象析构后地址被复用也不会认错
+    std::vector<ThreadShard *> m_shards;     // 正在被线程使用的分片
+    std::vector<ThreadShard *> m_freeShards; // 线程退出后清零的分片
+    ThreadShard m_retired;                   // 已经退出的线程的计数
+    std::mutex m_mutex;
+};
@@ -1,43 +1,289 @@
 #pragma once
 #include "google/protobuf/service.h"
 #include <unordered_map>
+#include <unordered_set>
 #include <muduo/net/TcpServer.h>
 #include <muduo/net/EventLoop.h>
 #include <muduo/net/InetAddress.h>
 #include <muduo/net/TcpConnection.h>
+#include <muduo/net/Channel.h>
+#include <muduo/net/EventLoopThreadPool.h>
 #include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <google/protobuf/descriptor.h>
+#include "rpctracer.h"
+#include "rpcadmission.h"
+#include "rpcscheduler.h"
+#include "rpcstream.h"
+#include "rpccache.h"
+#include "rpcsingleflight.h"
+#include "rpcmetrics.h"
+#include "rpcratelimiter.h"
+#include "rpcalias.h"
+#include "rpccompress.h"
+#include "rpclistener.h"
+#include "rpctransport.h"
+#include "rpcepoch.h"
+#include "rpcheader.pb.h"
+
+class ZkClient;
 
 // 框架提供发布rpc服务的网络对象类
 class RpcProvider
 {
 public:
+    RpcProvider();
+    ~RpcProvider();
+
     // 框架供给外部使用的，可以发布rpc方法的函数接口
+    // Run之后也可以调用，新服务立即可用，并在zookeeper上注册实例节点
     void NotifyService(google::protobuf::Service *service);
+    // 注销服务：新请求返回RPC_NOT_FOUND，zookeeper上的实例节点随之删除；
+    // 进行中的调用都结束后在某个io线程中回调on_removed，之后才能释放服务对象
+    bool UnregisterService(const std::string &service_name, std::function<void()> on_removed = nullptr);
 
     // 启动rpc服务节点，开始提供rpc远程网络调用服务
+    // 收到SIGTERM/SIGINT后进入下线流程，所有请求处理完后返回
     void Run();
 
 private:
     muduo::net::EventLoop m_eventLoop;
+    //默认模式下只有一个TcpServer，在m_eventLoop上accept后轮询分发给io线程；
+    //rpc_reuseport模式下每个io线程一个TcpServer，各自持有一个SO_REUSEPORT监听socket
+    std::vector<std::unique_ptr<muduo::net::TcpServer>> m_servers;
+    std::unique_ptr<muduo::net::EventLoopThreadPool> m_ioLoopPool;
+    std::unique_ptr<ZkClient> m_zkClient;
+    //本节点注册的临时实例节点，下线时主动删除
+    //按服务名分组，下线时全部删除，注销服务时删除对应的一组
+    std::unordered_map<std::string, std::vector<std::string>> m_instancePaths;
+
+    //保存一个服务方法的描述以及它在调度器中的队列(并发上限和优先级)
+    struct MethodInfo
+    {
+        const google::protobuf::MethodDescriptor *m_descriptor;
+        RpcScheduler::MethodQueue *m_queue;
+        uint32_t m_id;          //方法编号，用于组成响应缓存的键以及索引指标和限流的方法表
+        int64_t m_cacheTtlUs;   //响应缓存的有效期，0表示不缓存
+        bool m_coalesce;        //幂等方法，相同的请求合并执行
+        uint32_t m_aliasBytes;  //不小于这个大小的bytes字段引用输入数据而不复制，0表示不引用
+        RpcCompressPolicy m_compress; //响应的压缩策略，流式方法不压缩
+        int m_maxStreams;       //流式方法同时进行的流数上限，0表示工作线程数的一半
+    };
+    //一个"服务.方法"的编号和调度队列，分配后不释放，同名方法重新注册时沿用，由m_registerMutex保护。
+    //编号不超过RpcMetrics::kUnknownMethod，重新注册的方法在缓存TTL内仍可能命中注销前缓存的响应
+    struct MethodSlot
+    {
+        uint32_t m_id;
+        RpcScheduler::MethodQueue *m_queue;
+    };
+    std::unordered_map<std::string, MethodSlot> m_methodSlots;
 
-    //保存一个服务对象以及它的方法信息
+    //保存一个服务对象以及它的方法信息，发布之后不再修改
     struct ServiceInfo
     {
         //保存服务对象
         google::protobuf::Service *m_service;
         //保存服务方法
-        std::unordered_map<std::string,const google::protobuf::MethodDescriptor*> m_methodMap;
+        std::unordered_map<std::string,MethodInfo> m_methodMap;
+        //注销时设置，最后一个引用释放时回调
+        std::function<void()> m_onRemoved;
+        ~ServiceInfo() { if (m_onRemoved) m_onRemoved(); }
     };
 
     //存储注册成功的服务对象和其服务方法的所有信息
-    std::unordered_map<std::string,ServiceInfo> m_serviceMap;
+    //服务表按RCU方式更新：io线程和各个传输的线程在RpcEpoch读区间中无锁查找当前的表，
+    //注册和注销时复制一份修改后整体替换，等替换之前开始的读区间都结束后再释放旧表
+    typedef std::unordered_map<std::string, std::shared_ptr<ServiceInfo>> ServiceMap;
+    std::atomic<const ServiceMap*> m_serviceMap;
+    std::mutex m_registerMutex; //串行化服务表的修改和zookeeper注册
+    bool m_registered;           //已经在zookeeper上注册，之后新增的服务立即注册，由m_registerMutex保护
+    void PublishServiceMap(const ServiceMap *services);
+    //查找服务，读区间只覆盖这次查找，返回的服务项由引用计数保持，没有这个服务时返回空
+    std::shared_ptr<ServiceInfo> FindService(const std::string &service_name);
+    //在zookeeper上注册服务的实例节点，需要持有m_registerMutex
+    void RegisterInstances(const std::string &service_name, const ServiceInfo &service_info);
+
+    //一次rpc调用在provider端的上下文，从请求解析一直存活到响应发送完成
+    struct RpcCall
+    {
+        std::shared_ptr<RpcResponder> responder; //请求所在的连接，响应经由它发回
+        google::protobuf::Service *service;
+        std::shared_ptr<ServiceInfo> owner; //持有服务表项，服务注销后等进行中的调用结束才释放
+        const google::protobuf::MethodDescriptor *method;
+        RpcScheduler::MethodQueue *queue;
+        uint32_t method_id;
+        uint64_t request_id;   //调用方分配的请求id，随响应带回
+        int64_t receive_us;    //请求到达的时间，用于计算排队延迟
+        int64_t dispatch_us;   //开始执行方法的时间，用于计算方法执行时间
+        uint32_t request_size;
+        google::protobuf::Message *request;
+        google::protobuf::Message *response;
+        bool sampled;          //是否被追踪采样
+        RpcTraceRecord trace;  //采样记录，sampled为false时不填充
+        std::shared_ptr<RpcServerStream> stream; //流式方法的输出流，普通方法为空
+        muduo::net::TcpConnectionPtr stream_conn; //流式方法所在的muduo连接，流控帧经由它收发
+        std::string cache_key; //可缓存方法的缓存键，响应成功后写入缓存
+        int64_t cache_ttl_us;
+        std::string flight_key; //合并执行的键，非空表示有相同的请求在等待这次调用的结果
+        std::unique_ptr<RpcAliasController> alias; //开启了引用解析的方法传给处理函数的controller
+        RpcCompressPolicy compress; //按调用方接受的算法协商后的响应压缩策略
+    };
+
+    //每个连接的写合并和背压状态，除了缓冲大小的统计之外只在连接所属的io线程中访问。
+    //它同时是这个连接的RpcResponder，muduo连接上的请求和其他传输上的请求经过同一条执行路径
+    struct ConnContext : public RpcResponder
+    {
+        RpcProvider *provider;
+        std::weak_ptr<muduo::net::TcpConnection> conn; //不持有连接，避免和连接的context互相引用
+        muduo::net::Buffer pending; //本轮事件循环中完成的响应帧，在循环末尾一次发送
+        int pending_count;          //pending中的响应个数
+        bool flush_queued;          //是否已经安排了本轮的发送
+        bool paused;                //输出缓冲超过高水位，暂停读取和处理新的请求
+        //连接上进行中的流，按request_id查找，用于投递流控帧和在断开时取消
+        std::unordered_map<uint64_t, std::shared_ptr<RpcServerStream>> streams;
+        std::string peer;                //对端地址，作为连接内存指标的标签
+        std::string peer_ip;             //调用方没有带client_id时限流使用的调用方标识
+        std::atomic<size_t> input_bytes; //最近一次统计的输入和输出缓冲大小，指标线程只读
+        std::atomic<size_t> output_bytes;
+        ConnContext(RpcProvider *provider, const muduo::net::TcpConnectionPtr &conn)
+            : provider(provider), conn(conn), pending_count(0), flush_queued(false), paused(false), input_bytes(0), output_bytes(0) {}
+
+        //响应经由QueueResponce合并发送，连接已经断开时返回false
+        bool Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+                  const google::protobuf::Message *body) override;
+        bool SendFrame(const std::string &frame) override;
+        std::string Peer() const override { return peer_ip; }
+    };
+    //写合并统计：发送次数和发送的响应总数，两者之比为每次发送平均合并的响应数
+    std::atomic<uint64_t> m_flushCount;
+    std::atomic<uint64_t> m_flushedResponces;
+
+    //写端背压：连接的输出缓冲超过高水位时停止读取，缓冲发送完后恢复，避免慢的调用方让输出缓冲无限增长
+    size_t m_highWaterMark;
+    //请求帧的大小上限，超过时断开连接
+    size_t m_maxFrameBytes;
+    std::atomic<int> m_pausedConnections;
+    std::atomic<uint64_t> m_backpressureEvents;
+    //所有连接的输入和输出缓冲总大小
+    std::atomic<int64_t> m_inputBytes;
+    std::atomic<int64_t> m_outputBytes;
+    //所有连接的状态，用于输出每个连接的内存指标
+    std::unordered_set<ConnContext*> m_connContexts;
+    std::mutex m_connMutex;
+
+    //所有进行中的流，停止时取消它们，避免工作线程阻塞在等待配额上
+    std::unordered_set<RpcServerStream*> m_streams;
+    std::mutex m_streamMutex;
+    //按方法编号统计进行中的流数。流的处理函数在整个流期间占用一个工作线程，
+    //超过方法的流数上限时以RPC_OVERLOADED拒绝新的流，留给普通调用的工作线程不会被流占满
+    std::vector<std::atomic<int>> m_activeStreams;
+
+    //幂等方法的响应缓存
+    RpcResponseCache m_cache;
+
+    //幂等方法相同请求的合并执行
+    RpcSingleflight m_singleflight;
+
+    //按方法统计的指标，由metrics_port上的http服务以Prometheus文本格式输出
+    RpcMetrics m_metrics;
+    std::unique_ptr<muduo::net::TcpServer> m_metricsServer;
+    std::atomic<int> m_connections;
+
+    //按调用方和方法限流
+    RpcRateLimiter m_rateLimiter;
+
+    //准入控制，过载时提前拒绝请求
+    RpcAdmissionController m_admission;
+    //方法执行线程池，按方法并发上限和优先级调度
+    RpcScheduler m_scheduler;
+
+    //热重启：配置了hot_restart_path时监听socket由m_listener管理，新进程启动时通过这个unix socket
+    //从旧进程接过监听socket，hot_restart_connections=true时还会接过旧进程中空闲的连接
+    std::unique_ptr<RpcListener> m_listener;
+    //rpc_unix_path：额外监听的unix域socket，同机的调用方不经过TCP协议栈
+    std::unique_ptr<RpcListener> m_unixListener;
+    std::string m_unixPath;
+    //rpc_io_engine不是muduo时接管rpcserverip:rpcserverport的传输，启用时不创建m_servers
+    std::unique_ptr<RpcServerTransport> m_engine;
+    //rpc_transports和rpc_shm_path开启的额外传输，例如同机调用方的共享内存
+    std::vector<std::unique_ptr<RpcServerTransport>> m_transports;
+    std::string m_hotRestartPath;
+    int m_hotRestartListenFd;                              //等待下一个新进程连接的unix socket
+    std::unique_ptr<muduo::net::Channel> m_hotRestartChannel;
+    int m_handoffFd;                                       //交接连接：新进程中连着旧进程，旧进程中连着新进程
+    std::unique_ptr<muduo::net::Channel> m_handoffChannel;
+    std::mutex m_handoffMutex;                             //交出连接时多个io线程都会写交接连接
+    bool m_handedOff;                                      //旧进程：监听socket已经交给新进程
+    bool m_handoffReady;                                   //旧进程：新进程已经完成注册
+    std::atomic<bool> m_handingOff;                        //旧进程：正在把连接交给新进程，不再处理请求
+    std::atomic<int> m_handoffRemaining;
+
+    //信号通知管道的读端，信号处理函数只往管道里写信号值，真正的处理放在事件循环中
+    std::unique_ptr<muduo::net::Channel> m_signalChannel;
+
+    //下线流程：先注销zookeeper实例节点，宽限期内照常服务按旧路由到达的请求，
+    //宽限期结束后以RPC_UNAVAILABLE拒绝新请求，等处理中的请求完成后退出事件循环
+    std::atomic<bool> m_draining;
+    std::atomic<bool> m_rejectNew;
+    int64_t m_drainDeadline; //等待处理中请求的截止时间(微秒)
 
     //新的socket连接回调const muduo::net::TcpConnectionPtr &, google::protobuf::Message*
     void OnConnection(const muduo::net::TcpConnectionPtr &);
-    //已建立连接的读写回调
+    //已建立连接的读写回调，一次可能读到多个流水线发送的请求帧
     void OnMessage(const muduo::net::TcpConnectionPtr &, muduo::net::Buffer *, muduo::Timestamp);
+    //处理一个完整的请求帧，所有传输的请求都经过这里：查找方法、限流、解压、缓存、合并、准入、调度和执行
+    void OnRequest(const std::shared_ptr<RpcResponder> &, const mprpc::RpcHeader &, uint32_t header_size,
+                   const char *args, int64_t receive_us);
+    //执行rpc方法，已经占用了方法的并发名额
+    void Dispatch(RpcCall*);
     //Closure的回调操作，用于序列化rpc的响应和网络发送
-    void SendRpcResponce(const muduo::net::TcpConnectionPtr&, google::protobuf::Message*);
+    void SendRpcResponce(RpcCall*);
+    //请求无法执行时直接回复错误状态
+    void SendErrorResponce(const std::shared_ptr<RpcResponder>&, uint64_t, uint32_t, mprpc::RpcStatus, const std::string&, RpcTraceRecord*);
+    //合并执行的调用结束，把结果交给等待的相同请求，key为空时什么也不做
+    void CompleteFlight(const std::string&, mprpc::RpcStatus, const std::string&, const std::string&);
+    //流式方法：创建输出流并登记到连接上，流结束或者连接断开时注销，注销时归还方法的流数名额
+    std::shared_ptr<RpcServerStream> CreateStream(const muduo::net::TcpConnectionPtr&, uint64_t, uint32_t);
+    void RemoveStream(const muduo::net::TcpConnectionPtr&, uint64_t, RpcServerStream*, uint32_t);
+    //流建立之后的消息、半关闭和流控帧
+    void OnStreamFrame(const muduo::net::TcpConnectionPtr&, const mprpc::RpcHeader&, const char*);
+    //把响应帧放入连接的待发送缓冲，同一轮事件循环中完成的响应合并成一次发送
+    void QueueResponce(const muduo::net::TcpConnectionPtr&, const std::string&);
+    void FlushResponces(const muduo::net::TcpConnectionPtr&);
+    //输出缓冲超过高水位时暂停读取，发送完毕时恢复
+    void OnHighWaterMark(const muduo::net::TcpConnectionPtr&, size_t);
+    void OnWriteComplete(const muduo::net::TcpConnectionPtr&);
+    //更新连接的缓冲大小统计
+    void UpdateBufferGauges(const muduo::net::TcpConnectionPtr&, ConnContext*);
+    //安装信号处理，SIGUSR1用于按需导出追踪记录，SIGTERM/SIGINT用于优雅下线
+    void SetupSignalHandler();
+    void OnSignal(muduo::Timestamp);
+    void StartDrain();
+    void StopAcceptingRequests();
+    void CheckDrained();
+    //指标http服务：收到GET /metrics时返回所有指标
+    void OnMetricsMessage(const muduo::net::TcpConnectionPtr&, muduo::net::Buffer*, muduo::Timestamp);
+    void RenderMetrics(std::string*);
+    //创建监听的TcpServer，返回io线程数
+    int CreateServers(const muduo::net::InetAddress &address);
+    void CreateListener(const muduo::net::InetAddress &address, int io_threads);
+    void CreateUnixListener();
+    void StartTransports();
+    //RpcServerTransport传输上的一个请求帧，在传输自己的线程中切分后交给OnRequest，
+    //和muduo连接上的请求一样经过准入控制、调度和响应压缩
+    void OnInlineRequest(const std::shared_ptr<RpcResponder>&, const char *frame, uint32_t len);
+    //热重启的交接流程
+    void SetupHotRestart();
+    void OnHotRestartAccept(muduo::Timestamp);
+    void OnHandoffMessage(muduo::Timestamp);
+    void CloseHandoff();
+    void StartConnectionHandoff();
+    void CheckHandoffDrained();
+    void HandoffConnection(const muduo::net::TcpConnectionPtr&, int fd);
+    void FinishHandoff();
+    void DestroyServers();
 };
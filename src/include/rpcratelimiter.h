@@ -0,0 +1,62 @@
+#pragma once
+#include <string>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+// 无锁的令牌桶，用GCRA算法实现：只保存下一个请求的理论到达时间，放行一个请求就把它推后一个发放间隔，
+// 理论到达时间超前当前时间超过突发容量时拒绝。整个状态是一个原子整数，放行只需要一次CAS
+class TokenBucket
+{
+public:
+    TokenBucket() : m_intervalNs(0), m_toleranceNs(0), m_tat(0) {}
+
+    // qps为0表示不限制；burst为允许的突发请求数，不配置时等于qps
+    void SetRate(double qps, double burst);
+    bool Limited() const { return m_intervalNs > 0; }
+    bool Acquire(int64_t now_ns) { return Acquire(m_tat, m_intervalNs, m_toleranceNs, now_ns); }
+
+    static bool Acquire(std::atomic<int64_t> &tat, int64_t interval_ns, int64_t tolerance_ns, int64_t now_ns);
+    // 归还一个已经取得的令牌：把理论到达时间提前一个发放间隔
+    static void Release(std::atomic<int64_t> &tat, int64_t interval_ns);
+    static void Parameters(double qps, double burst, int64_t *interval_ns, int64_t *tolerance_ns);
+
+private:
+    int64_t m_intervalNs;  // 两个令牌之间的间隔
+    int64_t m_toleranceNs; // 突发容量对应的时间
+    std::atomic<int64_t> m_tat;
+};
+
+// provider端的限流：按调用方和按方法各一组令牌桶，超出限制的请求以RPC_THROTTLED拒绝
+//   rate_limit_peer_qps=1000                          每个调用方的请求速率，不配置则不限制
+//   rate_limit_peer_burst=2000                        每个调用方允许的突发请求数
+//   rate_limit_peer_slots=4096                        调用方令牌桶的槽位数
+//   FriendServiceRpc.GetFriendList.rate_limit_qps=5000   方法的请求速率
+//   FriendServiceRpc.GetFriendList.rate_limit_burst=5000
+// 调用方按client_id区分，调用方没有设置时按连接的对端地址区分。调用方的令牌桶是固定大小的槽位表，
+// 按哈希分配，不需要加锁也不需要淘汰，代价是哈希冲突的调用方共用一个桶
+class RpcRateLimiter
+{
+public:
+    static const uint32_t kMaxMethods = 1024;
+
+    RpcRateLimiter();
+    ~RpcRateLimiter();
+
+    // 从配置文件读取调用方的限制，需要在provider启动前调用
+    void Init();
+    void SetMethodLimit(uint32_t method_id, double qps, double burst);
+
+    // 调用方和方法都还有令牌时返回true，方法拒绝时归还已经取得的调用方令牌
+    bool Allow(const std::string &peer, uint32_t method_id, int64_t now_us);
+
+    uint64_t Throttled() const { return m_throttled.load(std::memory_order_relaxed); }
+
+private:
+    int64_t m_peerIntervalNs;
+    int64_t m_peerToleranceNs;
+    size_t m_peerSlotCount;
+    std::unique_ptr<std::atomic<int64_t>[]> m_peerSlots;
+    std::atomic<TokenBucket *> m_methods[kMaxMethods];
+    std::atomic<uint64_t> m_throttled{0};
+};
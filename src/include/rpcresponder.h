@@ -0,0 +1,33 @@
+#pragma once
+#include "rpcheader.pb.h"
+#include <google/protobuf/message.h>
+#include <string>
+#include <memory>
+#include <functional>
+#include <cstdint>
+
+// 一个调用方连接的回复端，所有传输(muduo的TCP和unix socket、共享内存、io_uring、模拟网络)都通过这个接口回复响应，
+// provider的执行逻辑不关心响应经由哪种传输发出
+class RpcResponder
+{
+public:
+    virtual ~RpcResponder() {}
+
+    // 把响应帧发给调用方，可以在任意线程调用；body为空表示只回复状态
+    virtual bool Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+                      const google::protobuf::Message *body) = 0;
+    // 发送已经组装好的完整响应帧，例如压缩的响应和缓存中的响应，可以在任意线程调用
+    virtual bool SendFrame(const std::string &frame) = 0;
+    // 调用方没有带client_id时限流使用的调用方标识
+    virtual std::string Peer() const = 0;
+
+protected:
+    // 填写响应头并返回整帧的大小(4字节header长度 + RpcResponseHeader + body)，body的大小同时被缓存
+    static uint32_t PrepareFrame(mprpc::RpcResponseHeader *header, uint64_t request_id, mprpc::RpcStatus status,
+                                 const std::string &error_text, const google::protobuf::Message *body);
+    // 把PrepareFrame准备好的帧序列化到out，out至少有PrepareFrame返回的大小
+    static void WriteFrame(char *out, const mprpc::RpcResponseHeader &header, const google::protobuf::Message *body);
+};
+
+// 一个完整的请求帧：4字节header长度 + RpcHeader + 参数，回调返回后frame指向的内存即被释放
+typedef std::function<void(const std::shared_ptr<RpcResponder> &, const char *frame, uint32_t len)> RpcFrameCallback;
@@ -0,0 +1,80 @@
+#pragma once
+#include <deque>
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// rpc方法的优先级，线程池饱和时按优先级从高到低调度
+enum RpcPriority
+{
+    RPC_PRIORITY_CRITICAL = 0, // 廉价且关键的调用，例如Login
+    RPC_PRIORITY_DEFAULT,
+    RPC_PRIORITY_SHEDDABLE,    // 批量、可丢弃的调用，过载时最先被拒绝
+    RPC_PRIORITY_COUNT,
+};
+
+// 把配置中的critical/default/sheddable转换为优先级，无法识别时返回默认优先级
+RpcPriority ParseRpcPriority(const std::string &name);
+const char *RpcPriorityName(RpcPriority priority);
+
+// provider端的方法执行线程池：按方法限制并发数，按优先级调度
+class RpcScheduler
+{
+public:
+    using Task = std::function<void()>;
+    using ThreadInitCallback = std::function<void()>;
+
+    // 每个rpc方法一个等待队列，记录它的并发上限和当前执行数
+    struct MethodQueue
+    {
+        std::string name;
+        int max_concurrency; // 0表示不限制
+        RpcPriority priority;
+        int running;         // 已经开始执行但还没有返回响应的请求数
+        bool ready;          // 是否已经在就绪队列中
+        std::deque<Task> pending;
+    };
+
+    ~RpcScheduler();
+
+    // 注册一个方法，返回的指针在调度器的生命周期内有效
+    MethodQueue *AddMethod(const std::string &name, int max_concurrency, RpcPriority priority);
+
+    // 工作线程启动后、处理请求前调用，用于绑核等线程初始化
+    void SetThreadInitCallback(const ThreadInitCallback &cb) { m_threadInitCallback = cb; }
+    // 启动thread_num个工作线程，等所有线程完成初始化后返回
+    // thread_num为0时不启动，由调用方在io线程中直接执行
+    void Start(int thread_num);
+    void Stop();
+    int ThreadNum() const { return static_cast<int>(m_threads.size()); }
+
+    // 提交一个请求，等到该方法有空闲的并发名额并且没有更高优先级的请求时执行
+    void Submit(MethodQueue *mq, Task task);
+    // 不经过线程池直接占用一个并发名额，名额已满时返回false
+    bool TryAcquire(MethodQueue *mq);
+    // 请求的响应发送完成后归还并发名额
+    void Finish(MethodQueue *mq);
+    // 线程池状态，用于监控：正在执行的请求数和排队等待的请求数
+    void Stats(int *running, size_t *queued);
+
+private:
+    bool Runnable(const MethodQueue *mq) const
+    {
+        return !mq->pending.empty() && (mq->max_concurrency == 0 || mq->running < mq->max_concurrency);
+    }
+    void MarkReady(MethodQueue *mq);
+    void WorkerLoop();
+
+    std::vector<std::unique_ptr<MethodQueue>> m_methods;
+    // 每个优先级一个就绪队列，存放有待执行请求并且还有并发名额的方法，同优先级的方法轮流执行
+    std::deque<MethodQueue *> m_ready[RPC_PRIORITY_COUNT];
+    std::vector<std::thread> m_threads;
+    ThreadInitCallback m_threadInitCallback;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    bool m_stop = false;
+};
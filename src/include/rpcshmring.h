@@ -0,0 +1,87 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+// 共享内存中的单生产者单消费者环形队列，一个方向一个队列，两个进程各自映射同一段内存
+// 队列中每条记录为4字节长度 + 数据，按8字节对齐；尾部放不下一条记录时写一个回绕标记，从头开始写。
+// 生产者直接在Reserve返回的内存中构造数据，Commit之后消费者可见，数据全程不经过内核。
+// 通知：消费者睡眠前设置waiting标志，生产者提交后看到标志才写eventfd，消费者忙等期间完全没有系统调用
+class RpcShmRing
+{
+public:
+    // 队列在共享内存中的头部，生产者和消费者的位置放在不同的缓存行上
+    struct Header
+    {
+        alignas(64) std::atomic<uint64_t> head;     // 消费者已经读到的位置，只有消费者写
+        alignas(64) std::atomic<uint64_t> tail;     // 生产者已经提交的位置，只有生产者写
+        alignas(64) std::atomic<uint32_t> waiting;  // 消费者正在eventfd上睡眠
+        uint32_t capacity;
+    };
+
+    RpcShmRing();
+
+    // 队列占用的共享内存大小，capacity必须是2的幂
+    static size_t Size(uint32_t capacity) { return sizeof(Header) + capacity; }
+    // 使用base开始的共享内存，init为true时初始化头部(创建方)；event_fd用于唤醒这个队列的消费者
+    void Attach(char *base, uint32_t capacity, int event_fd, bool init);
+
+    // 生产者：预留len字节，空间不足时最多等待timeout_ms毫秒，超时或len超过上限返回nullptr
+    char *Reserve(uint32_t len, int timeout_ms);
+    // 生产者：提交最近一次预留的len字节，必要时唤醒消费者
+    void Commit(uint32_t len);
+
+    // 消费者：取出下一条记录但不移除，队列为空或者记录不合法返回nullptr。
+    // 队列的位置和记录长度都由对端进程写入，不合法时设置Corrupted，之后这个队列不能再使用
+    const char *Peek(uint32_t *len);
+    bool Corrupted() const { return m_corrupted; }
+    // 消费者：移除Peek返回的记录，之后这段内存可能被生产者覆盖
+    void Consume(uint32_t len);
+    // 消费者：等待队列中有数据，先忙等spin_us微秒，再在eventfd上最多睡眠timeout_ms毫秒
+    bool Wait(int64_t spin_us, int timeout_ms);
+
+    // 单条记录的上限
+    uint32_t MaxRecord() const { return m_capacity / 2 - 8; }
+
+private:
+    static uint32_t Align(uint32_t len) { return (len + 4 + 7) & ~7u; }
+    bool Empty() const;
+
+    Header *m_header;
+    char *m_data;
+    uint32_t m_capacity;
+    int m_eventFd;
+    uint32_t m_pendingSkip; // 最近一次预留时跳过的尾部空间
+    bool m_corrupted;       // 消费者：读到过不合法的记录
+};
+
+// 一段共享内存，包含请求和响应两个方向的队列，以及唤醒两端消费者的eventfd
+// provider创建后通过unix socket把memfd和eventfd交给调用方，调用方映射同一段内存
+class RpcShmSegment
+{
+public:
+    RpcShmSegment();
+    ~RpcShmSegment();
+
+    // provider：创建memfd和eventfd，ring_bytes向上取整为2的幂
+    bool Create(uint32_t ring_bytes);
+    // 调用方：映射收到的memfd，之后这些fd由本对象负责关闭
+    bool Attach(int mem_fd, int request_event_fd, int response_event_fd);
+
+    RpcShmRing &Requests() { return m_requests; }
+    RpcShmRing &Responses() { return m_responses; }
+    int MemFd() const { return m_memFd; }
+    int RequestEventFd() const { return m_requestEventFd; }
+    int ResponseEventFd() const { return m_responseEventFd; }
+
+private:
+    bool Map(uint32_t capacity, bool init);
+
+    int m_memFd;
+    int m_requestEventFd;
+    int m_responseEventFd;
+    char *m_base;
+    size_t m_size;
+    RpcShmRing m_requests;
+    RpcShmRing m_responses;
+};
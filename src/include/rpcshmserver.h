@@ -0,0 +1,75 @@
+#pragma once
+#include "rpcshmring.h"
+#include "rpctransport.h"
+#include <string>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <list>
+#include <atomic>
+
+// provider端的一个共享内存会话，对应一个调用方
+class RpcShmSession : public RpcResponder
+{
+public:
+    RpcShmSession(int sock, std::unique_ptr<RpcShmSegment> segment);
+    ~RpcShmSession();
+
+    // 把响应帧直接序列化到响应队列中，格式和TCP上的响应帧相同
+    bool Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+              const google::protobuf::Message *body) override;
+    bool SendFrame(const std::string &frame) override;
+    std::string Peer() const override { return "shm"; }
+
+private:
+    friend class RpcShmServer;
+    int m_sock; // 建立会话的unix socket，调用方退出时断开
+    std::unique_ptr<RpcShmSegment> m_segment;
+    std::mutex m_sendMutex; // 异步完成的方法可能在别的线程中回复，响应队列只允许一个生产者
+};
+
+// 共享内存传输的provider端，给同机对延迟敏感的调用方使用
+//   rpc_shm_path=/tmp/mprpc.shm    调用方连接这个unix socket建立会话，不配置则不开启
+//   rpc_shm_ring_kb=1024           每个方向的队列大小
+//   rpc_shm_busy_poll_us=50        会话线程睡眠前忙等的时间，0表示直接在eventfd上等待
+//                                  忙等需要调用方和会话线程各有空闲的核，核数不够时反而更慢
+//   rpc_shm_max_sessions=64        同时存在的会话上限，达到上限时新的调用方建立会话失败
+// 会话建立时provider创建memfd和两个eventfd，通过SCM_RIGHTS交给调用方。每个会话一个线程，
+// 请求在这个线程中直接从共享内存解析，不经过io线程，之后和TCP上的请求一样调度执行。调用方退出后会话线程结束，
+// 接受线程回收结束的线程，共享内存在会话的最后一个引用释放时解除映射
+class RpcShmServer : public RpcServerTransport
+{
+public:
+    RpcShmServer();
+    ~RpcShmServer();
+
+    // 监听配置中的rpc_shm_path
+    bool Start(const RpcFrameCallback &callback) override;
+    bool Start(const std::string &path, const RpcFrameCallback &callback);
+    // 停止接受新会话，断开所有会话并等待会话线程退出
+    void Stop() override;
+
+private:
+    // 一个会话线程，线程结束前设置finished，由接受线程join
+    struct SessionThread
+    {
+        std::thread thread;
+        std::atomic<bool> finished{false};
+    };
+
+    void AcceptLoop();
+    void SessionLoop(std::shared_ptr<RpcShmSession> session, SessionThread *self);
+    // 接受线程：join已经结束的会话线程
+    void ReapSessions();
+
+    std::string m_path;
+    uint64_t m_pathInode; // 热重启后路径会被新进程重新绑定，停止时只删除自己绑定的socket文件
+    int m_listenFd;
+    uint32_t m_ringBytes;
+    int64_t m_busyPollUs;
+    size_t m_maxSessions;
+    RpcFrameCallback m_callback;
+    std::atomic<bool> m_stopped;
+    std::thread m_acceptThread;
+    std::list<std::unique_ptr<SessionThread>> m_sessions; // 只在接受线程中修改，Stop在接受线程退出后访问
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include "rpctransport.h"
+#include <string>
+#include <memory>
+#include <thread>
+
+struct RpcSimListener;
+
+// 进程内的模拟网络：provider和调用方在同一个进程中，帧经由内存队列传递，按配置加上链路的延迟。
+// 用于在没有真实网络的环境中压测RPC层本身，或者在给定的延迟和带宽下比较调用方的策略
+//   rpc_sim_latency_us=0        单向延迟
+//   rpc_sim_bandwidth_mbps=0    链路带宽，帧的发送时间按大小计入延迟，0表示不限
+// provider以rpc_io_engine=sim启动时在模拟网络上登记rpcserverip:rpcserverport，
+// 调用方以rpc_transport=sim连接endpoint的ip:port。请求按到达顺序在一个线程中切分，之后和TCP上的请求一样调度执行
+class RpcSimServerTransport : public RpcServerTransport
+{
+public:
+    RpcSimServerTransport();
+    ~RpcSimServerTransport();
+
+    bool Start(const RpcFrameCallback &callback) override;
+    void Stop() override;
+
+private:
+    void Loop(RpcFrameCallback callback);
+
+    std::string m_address;
+    std::shared_ptr<RpcSimListener> m_listener;
+    std::thread m_thread;
+};
+
+class RpcSimClientTransport : public RpcClientTransport
+{
+public:
+    std::unique_ptr<RpcClientConnection> Connect(const RpcEndpoint &endpoint,
+                                                 google::protobuf::RpcController *controller) override;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <unordered_map>
+#include "rpcheader.pb.h"
+
+// provider端的请求合并：同一个幂等方法的相同请求正在执行时，后到的请求不再执行方法，
+// 而是挂在执行中的请求上，等它完成后拿到同一份序列化好的响应，热点key的缓存失效时保护后端
+class RpcSingleflight
+{
+public:
+    // 执行中的请求完成时回调等待者，body为序列化好的响应，status非RPC_OK时为空
+    using Waiter = std::function<void(mprpc::RpcStatus status, const std::string &error_text, const std::string &body)>;
+
+    // 没有相同的请求在执行时登记为执行者并返回true，执行者完成后必须调用Complete；
+    // 否则把waiter挂到执行中的请求上并返回false
+    bool Join(const std::string &key, const Waiter &waiter);
+    // 执行者完成，把结果交给所有等待者
+    void Complete(const std::string &key, mprpc::RpcStatus status, const std::string &error_text, const std::string &body);
+
+    uint64_t Coalesced() const { return m_coalesced.load(std::memory_order_relaxed); }
+
+private:
+    static const int kShardCount = 16;
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::vector<Waiter>> flights; // 执行中的请求和挂在上面的等待者
+    };
+
+    Shard &ShardOf(const std::string &key);
+
+    Shard m_shards[kShardCount];
+    std::atomic<uint64_t> m_coalesced{0};
+};
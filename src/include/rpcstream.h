@@ -0,0 +1,87 @@
+#pragma once
+#include "mprpccontroller.h"
+#include <google/protobuf/message.h>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <deque>
+#include <cstdint>
+
+// 流式调用中一端允许对端提前发送的消息个数：provider到调用方的方向由调用方在FRAME_CALL中指定，
+// 调用方到provider的方向固定从这个值开始，之后双方都按处理进度用FRAME_WINDOW归还配额
+const uint32_t kDefaultStreamWindow = 16;
+
+// 服务端流：流式方法的处理函数通过controller参数拿到它，最后调用done->Run()结束流，
+// done之前调用SetFailed会把错误状态带给调用方
+//   returns (stream Xxx)：用Write逐条写出消息
+//     RpcServerStream *stream = RpcServerStream::FromController(controller);
+//     for (...) { if (!stream->Write(entry)) break; }
+//     done->Run();
+//   (stream Xxx) returns：用Read逐条读取调用方的消息，读完后填写response，随结束帧一起返回
+//     while (stream->Read(&chunk)) { ... }
+//     done->Run();
+//   (stream Xxx) returns (stream Yyy)：双向流，读写可以交替进行
+// 两个方向上都是处理完收到的消息后才授予对端新的配额，配额用完时Write阻塞，缓存的消息数因此有上限。
+// 处理函数在整个流期间占用一个工作线程，同一方法同时进行的流数受<服务>.<方法>.max_streams限制，
+// 默认为rpc_worker_threads的一半，超过时新的流以RPC_OVERLOADED拒绝；调用方取消流或者断开连接时Read/Write返回false
+class RpcServerStream : public MprpcController
+{
+public:
+    // 把一条已经序列化的消息交给框架发送
+    using Sender = std::function<void(const std::string &body)>;
+    // 授予调用方继续发送的配额
+    using WindowSender = std::function<void(uint32_t window)>;
+
+    RpcServerStream(uint32_t window, const Sender &sender, const WindowSender &windowSender);
+
+    // 普通方法的controller不是流，返回nullptr
+    static RpcServerStream *FromController(google::protobuf::RpcController *controller);
+
+    // 写出一条消息，流被取消(调用方断开或者provider停止)时返回false，处理函数应当尽快结束
+    bool Write(const google::protobuf::Message &message);
+    // 读取调用方的下一条消息，调用方半关闭并且消息都已读完、或者流被取消时返回false
+    bool Read(google::protobuf::Message *message);
+
+    // 以下由框架在io线程中调用
+    // 调用方授予更多配额
+    void AddWindow(uint32_t window);
+    // 收到调用方的一条消息，调用方超出配额发送时返回false
+    bool PushMessage(const char *data, size_t len);
+    // 调用方半关闭，不会再有新的消息
+    void CloseRead();
+    // 取消流，唤醒阻塞中的Write和Read
+    void Cancel();
+    bool IsCanceled() const;
+
+private:
+    Sender m_sender;
+    WindowSender m_windowSender;
+    uint32_t m_window;        // 剩余的发送配额
+    uint32_t m_recvWindow;    // 调用方还可以发送的消息数
+    uint32_t m_consumed;      // 已经读取、还没有归还配额的消息数
+    std::deque<std::string> m_incoming;
+    bool m_readClosed;
+    bool m_canceled;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+};
+
+// 调用方接收服务端流：调用流式方法时用它作为controller，每收到一条消息就解析到response中并调用回调，
+// 回调返回false表示不再需要后续的消息，框架断开连接取消流。CallMethod在流结束后返回
+class RpcStreamController : public MprpcController
+{
+public:
+    using MessageCallback = std::function<bool(const google::protobuf::Message &)>;
+
+    // window：允许provider提前发送、还没有被回调处理的消息个数
+    explicit RpcStreamController(const MessageCallback &callback, uint32_t window = kDefaultStreamWindow)
+        : m_callback(callback), m_window(window == 0 ? kDefaultStreamWindow : window) {}
+
+    bool OnMessage(const google::protobuf::Message &message) { return m_callback(message); }
+    uint32_t Window() const { return m_window; }
+
+private:
+    MessageCallback m_callback;
+    uint32_t m_window;
+};
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+// 一条被采样的rpc请求记录，定长结构，便于直接拷贝进环形缓冲区
+struct RpcTraceRecord
+{
+    char side;              // 'C'表示调用方(MprpcChannel)，'P'表示服务方(RpcProvider)
+    int32_t status;         // 0表示成功，非0表示失败原因
+    int64_t start_us;       // 请求开始时间(微秒)
+    int64_t cost_us;        // 请求总耗时(微秒)
+    uint32_t header_size;   // rpc header序列化后的长度
+    uint32_t args_size;     // 请求参数序列化后的长度
+    uint32_t response_size; // 响应序列化后的长度
+    char service_name[32];
+    char method_name[32];
+
+    void SetName(const std::string &service, const std::string &method);
+};
+
+// rpc请求追踪：按采样率把请求记录写入无锁环形缓冲区，按需导出
+class RpcTracer
+{
+public:
+    static RpcTracer &GetInstance();
+
+    // 判断当前请求是否需要采样，未采样的请求只付出一次线程局部计数的代价
+    bool ShouldSample()
+    {
+        if (m_sampleInterval == 0)
+        {
+            return false;
+        }
+        thread_local uint32_t countdown = 0;
+        if (countdown > 1)
+        {
+            --countdown;
+            return false;
+        }
+        countdown = m_sampleInterval;
+        return true;
+    }
+
+    // 写入一条记录，多线程并发写入无需加锁，缓冲区满后覆盖最旧的记录
+    void Record(const RpcTraceRecord &record);
+    // 把缓冲区中的记录按写入顺序导出，返回导出的条数
+    size_t Dump(FILE *pf);
+    size_t DumpToFile(const std::string &path);
+
+    static int64_t NowMicros();
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> seq{0}; // 奇数表示正在写入，偶数(非0)表示写入完成
+        RpcTraceRecord record;
+    };
+
+    uint32_t m_sampleInterval; // 每m_sampleInterval个请求采样一个，0表示关闭
+    size_t m_mask;
+    std::vector<Slot> m_slots;
+    std::atomic<uint64_t> m_next{0};
+
+    RpcTracer();
+    RpcTracer(const RpcTracer &) = delete;
+    RpcTracer(RpcTracer &&) = delete;
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include "rpcresponder.h"
+#include "rpcheader.pb.h"
+#include <google/protobuf/service.h>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
+
+//一次调用的目标地址：unix_path非空时先尝试unix域socket，连接失败再连ip:port
+struct RpcEndpoint
+{
+    std::string ip;
+    uint16_t port;
+    std::string unix_path;
+};
+
+// provider端的传输：接受调用方、切分请求帧，完整的请求帧交给callback执行，响应经由RpcResponder发回。
+// muduo的TCP和unix socket是provider内建的传输，所有传输的请求都经过同样的准入控制、调度、缓存和压缩，
+// 流式方法和热重启只在内建传输上支持
+class RpcServerTransport
+{
+public:
+    virtual ~RpcServerTransport() {}
+
+    // 按配置启动，失败返回false
+    virtual bool Start(const RpcFrameCallback &callback) = 0;
+    // 停止接受请求，断开所有调用方并等待传输的线程退出
+    virtual void Stop() = 0;
+};
+
+// 调用方到provider的一条连接，析构时断开
+class RpcClientConnection
+{
+public:
+    virtual ~RpcClientConnection() {}
+
+    // 发送一个完整的请求帧(4字节header长度 + RpcHeader + 参数)，失败时设置controller并返回false
+    virtual bool WriteFrame(const std::string &frame, google::protobuf::RpcController *controller) = 0;
+    // 接收一个完整的响应帧，失败时设置controller并返回false
+    virtual bool ReadFrame(mprpc::RpcResponseHeader *header, std::string *body,
+                           google::protobuf::RpcController *controller) = 0;
+};
+
+// 调用方的传输，同一个对象被所有channel共享，可以在多个线程中同时使用
+class RpcClientTransport
+{
+public:
+    virtual ~RpcClientTransport() {}
+
+    // 连接endpoint，失败时设置controller并返回nullptr
+    virtual std::unique_ptr<RpcClientConnection> Connect(const RpcEndpoint &endpoint,
+                                                         google::protobuf::RpcController *controller) = 0;
+};
+
+// 按名字登记传输，配置中用名字选择，RPC层的代码不需要改动
+//   provider：rpc_io_engine=muduo|uring|sim   接管rpcserverip:rpcserverport的传输，muduo为内建的TCP
+//             rpc_transports=shm,...           额外开启的传输，配置了rpc_shm_path时自动包含shm
+//   调用方：  rpc_transport=tcp|uring|shm|sim  MprpcChannel使用的传输，默认tcp
+// 内建的传输：tcp(调用方，阻塞socket，优先走unix socket)、uring、shm、sim(进程内模拟网络)
+// uring只在CMake选项MPRPC_WITH_URING打开并且内核头文件支持时编译，没有编译时配置uring退回muduo/tcp
+class RpcTransportRegistry
+{
+public:
+    typedef std::function<std::unique_ptr<RpcServerTransport>()> ServerFactory;
+
+    static RpcTransportRegistry &GetInstance();
+
+    // 同名的传输后登记的覆盖先登记的
+    void RegisterServer(const std::string &name, const ServerFactory &factory);
+    void RegisterClient(const std::string &name, const std::shared_ptr<RpcClientTransport> &transport);
+
+    // 没有这个名字时返回nullptr
+    std::unique_ptr<RpcServerTransport> CreateServer(const std::string &name);
+    std::shared_ptr<RpcClientTransport> GetClient(const std::string &name);
+
+private:
+    RpcTransportRegistry();
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, ServerFactory> m_servers;
+    std::unordered_map<std::string, std::shared_ptr<RpcClientTransport>> m_clients;
+};
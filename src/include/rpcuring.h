@@ -0,0 +1,61 @@
+#pragma once
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#include <cstddef>
+#include <cstdint>
+
+// io_uring的最小封装，直接使用系统调用，不依赖liburing
+// 只提供io引擎用到的部分：提交队列、完成队列、固定缓冲区的注册，以及内核选择缓冲区的环(provided buffer ring)。
+// 一个RpcUring只能在一个线程中使用
+class RpcUring
+{
+public:
+    RpcUring();
+    ~RpcUring();
+
+    // 内核不支持io_uring时返回false
+    bool Init(unsigned entries);
+
+    // 取一个空闲的提交项，提交队列满时返回nullptr，先Submit再取
+    struct io_uring_sqe *GetSqe();
+    // 一次系统调用提交所有新的提交项，并等待至少wait_nr个完成项；返回提交的数量，出错返回-errno
+    int Submit(unsigned wait_nr);
+
+    // 取下一个完成项，没有时返回nullptr；处理完调用SeenCqe
+    struct io_uring_cqe *PeekCqe();
+    void SeenCqe();
+
+    // 注册固定缓冲区，之后READ_FIXED/WRITE_FIXED按下标使用，内核不用每次都映射用户内存
+    bool RegisterBuffers(const struct iovec *iovecs, unsigned count);
+
+    // 注册一组由内核在接收时挑选的缓冲区，count必须是2的幂；
+    // 接收完成时完成项的flags中带有缓冲区编号，数据处理完用RecycleBuffer还给内核
+    bool SetupBufferRing(uint16_t group, unsigned count, unsigned size);
+    char *Buffer(uint16_t id) const { return m_bufBase + static_cast<size_t>(id) * m_bufSize; }
+    void RecycleBuffer(uint16_t id);
+
+private:
+    int m_fd;
+    unsigned m_flags;
+    void *m_sqRing;
+    size_t m_sqRingSize;
+    void *m_cqRing;
+    size_t m_cqRingSize;
+    struct io_uring_sqe *m_sqes;
+    size_t m_sqesSize;
+    unsigned *m_sqHead;
+    unsigned *m_sqTail;
+    unsigned m_sqMask;
+    unsigned m_sqEntries;
+    unsigned m_sqLocalTail; // 已经填好、还没有发布给内核的提交项的尾部
+    unsigned *m_cqHead;
+    unsigned *m_cqTail;
+    unsigned m_cqMask;
+    struct io_uring_cqe *m_cqes;
+
+    struct io_uring_buf_ring *m_bufRing;
+    size_t m_bufRingSize;
+    char *m_bufBase;
+    unsigned m_bufCount;
+    unsigned m_bufSize;
+};
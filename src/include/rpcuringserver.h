@@ -0,0 +1,35 @@
+#pragma once
+#include "rpctransport.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+// 基于io_uring的provider io引擎，rpc_io_engine=uring时代替muduo的TcpServer
+//   rpc_io_threads=4             io线程数，每个线程一个io_uring和一个SO_REUSEPORT监听socket
+//   rpc_uring_entries=4096       每个io_uring的提交队列长度
+//   rpc_uring_buffers=1024       每个线程注册给内核的接收缓冲区个数(2的幂)
+//   rpc_uring_buffer_kb=16       每个接收缓冲区的大小
+//   rpc_max_frame_bytes=67108864 请求帧的大小上限，超过时断开连接，和muduo引擎相同
+// 监听socket上挂一个multishot accept，每个连接挂一个multishot recv，接收缓冲区由内核从注册的缓冲区环中挑选，
+// 一轮事件处理中产生的发送和重新挂载的请求在下一次进入内核时一起提交，一次io_uring_enter同时完成提交和等待。
+// 引擎只替换收发，请求和muduo引擎一样经过准入控制、限流、调度和响应压缩：rpc_worker_threads>0时方法在工作线程中执行，
+// 为0时在io线程中直接执行。流式方法和热重启只在muduo引擎上支持
+class RpcUringServer : public RpcServerTransport
+{
+public:
+    RpcUringServer();
+    ~RpcUringServer();
+
+    // 监听配置中的rpcserverip:rpcserverport；内核不支持io_uring或者监听失败时返回false
+    bool Start(const RpcFrameCallback &callback) override;
+    bool Start(const std::string &ip, uint16_t port, int threads, const RpcFrameCallback &callback);
+    void Stop() override;
+
+    int Connections() const;
+
+private:
+    class Worker;
+    class Connection;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+};
@@ -22,7 +22,10 @@ public:
     ~ZkClient();
     
     void Start();
-    void Create(const char *path, const char *data, int datalen, int state = 0);
+    // 返回实际创建的节点路径，顺序节点会带上zookeeper生成的序号，失败时返回空串
+    std::string Create(const char *path, const char *data, int datalen, int state = 0);
+    // 删除节点，成功或节点不存在时返回true
+    bool Delete(const char *path);
     std::string GetData(const char *path);
     std::vector<std::string> GetChildren(const char* path);
     
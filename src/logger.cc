@@ -4,8 +4,10 @@
 
 Logger& Logger::GetInstance()
 {
-    static Logger log;
-    return log;
+    // 写日志线程是detach的，一直阻塞在队列上，Logger对象不能在进程退出时析构，
+    // 否则析构条件变量会等待这个线程而导致进程无法正常退出
+    static Logger *log = new Logger();
+    return *log;
 }
 
 Logger::Logger()
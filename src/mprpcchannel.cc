@@ -3,15 +3,189 @@
 #include "mprpcapplication.h"
 #include "mprpccontroller.h"
 #include "zookeeperutil.h"
+#include "rpctracer.h"
+#include "rpcstream.h"
+#include "rpclocalregistry.h"
+#include "rpcconcurrencylimiter.h"
+#include "rpccompress.h"
+#include "logger.h"
 
 #include <string>
+#include <cstring>
+#include <atomic>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/un.h>
+#include <ifaddrs.h>
 #include <errno.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <unistd.h>
 
+//调用结束时提交采样记录，覆盖CallMethod中所有提前返回的分支
+struct CallTraceGuard
+{
+    bool sampled;
+    RpcTraceRecord trace;
+
+    CallTraceGuard() : sampled(RpcTracer::GetInstance().ShouldSample()) {}
+    ~CallTraceGuard()
+    {
+        if (sampled)
+        {
+            trace.cost_us = RpcTracer::NowMicros() - trace.start_us;
+            RpcTracer::GetInstance().Record(trace);
+        }
+    }
+};
+
+MprpcChannel::MprpcChannel()
+    : m_preferUnix(MprpcApplication::GetInstance().GetConfig().Load("rpc_prefer_unix")=="true")
+{
+    //rpc_transport：调用使用的传输，默认tcp；兼容rpc_io_engine=uring
+    MprpcConfig &config=MprpcApplication::GetInstance().GetConfig();
+    std::string name=config.Load("rpc_transport");
+    if(name.empty())
+    {
+        name=config.Load("rpc_io_engine")=="uring" ? "uring" : "tcp";
+    }
+    if(!SetTransport(name))
+    {
+        LOG_ERR("unknown rpc_transport %s, use tcp",name.c_str());
+        SetTransport("tcp");
+    }
+}
+
+bool MprpcChannel::SetTransport(const std::string &name)
+{
+    std::shared_ptr<RpcClientTransport> transport=RpcTransportRegistry::GetInstance().GetClient(name);
+    if(!transport)
+    {
+        return false;
+    }
+    m_transport=transport;
+    return true;
+}
+
+//本机网卡上的所有IPv4地址
+static bool IsLocalAddress(const std::string &ip)
+{
+    static std::unordered_set<std::string> addresses=[]()
+    {
+        std::unordered_set<std::string> result{"127.0.0.1"};
+        struct ifaddrs *ifaddr=nullptr;
+        if(getifaddrs(&ifaddr)==0)
+        {
+            for(struct ifaddrs *ifa=ifaddr;ifa!=nullptr;ifa=ifa->ifa_next)
+            {
+                if(ifa->ifa_addr!=nullptr&&ifa->ifa_addr->sa_family==AF_INET)
+                {
+                    char buf[INET_ADDRSTRLEN]={0};
+                    inet_ntop(AF_INET,&reinterpret_cast<struct sockaddr_in*>(ifa->ifa_addr)->sin_addr,buf,sizeof(buf));
+                    result.insert(buf);
+                }
+            }
+            freeifaddrs(ifaddr);
+        }
+        return result;
+    }();
+    return addresses.count(ip)>0;
+}
+
+//从zookeeper查找本机上发布了这个方法并开放了unix socket的provider，实例节点的数据为"ip:port unix=路径"
+//结果按方法缓存5秒，没有找到时返回空串。命中缓存只加读锁；查询zookeeper在锁外进行，
+//过期的条目先延长有效期，由第一个发现过期的线程去刷新，其他线程在刷新期间继续使用旧的结果
+static std::string ResolveUnixPath(const std::string &service_name, const std::string &method_name)
+{
+    static std::shared_mutex mutex;
+    static std::unordered_map<std::string,std::pair<std::string,int64_t>> cache;
+    const int64_t ttl_us=5000000;
+
+    std::string method_path="/"+service_name+"/"+method_name;
+    int64_t now_us=RpcTracer::NowMicros();
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it=cache.find(method_path);
+        if(it!=cache.end()&&it->second.second>now_us)
+        {
+            return it->second.first;
+        }
+    }
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto it=cache.find(method_path);
+        if(it!=cache.end())
+        {
+            if(it->second.second>now_us)
+            {
+                return it->second.first;
+            }
+            it->second.second=now_us+ttl_us;
+        }
+    }
+
+    //第一次使用时连接zookeeper，并发的第一次调用等待同一次连接完成
+    static std::unique_ptr<ZkClient> zkCli=[]()
+    {
+        MprpcConfig &config=MprpcApplication::GetInstance().GetConfig();
+        std::unique_ptr<ZkClient> client(new ZkClient(config.Load("zookeeperip")+":"+config.Load("zookeeperport")));
+        client->Start();
+        return client;
+    }();
+    std::string unix_path;
+    if(zkCli->IsConnected())
+    {
+        for(const std::string &node : zkCli->GetChildren(method_path.c_str()))
+        {
+            std::string data=zkCli->GetData((method_path+"/"+node).c_str());
+            size_t pos=data.find(" unix=");
+            if(pos!=std::string::npos&&IsLocalAddress(data.substr(0,data.find(':'))))
+            {
+                unix_path=data.substr(pos+6);
+                break;
+            }
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    cache[method_path]={unix_path,RpcTracer::NowMicros()+ttl_us};
+    return unix_path;
+}
+
+//provider以RPC_UNKNOWN_DICT拒绝过字典的方法，本线程在这段时间内不用字典压缩请求，之后再试探provider是否已经加载
+static const int64_t kDictSuspendUs=30*1000*1000;
+static thread_local std::unordered_map<const google::protobuf::MethodDescriptor*,int64_t> t_dictSuspended;
+
+static void SuspendDictionary(const google::protobuf::MethodDescriptor *method)
+{
+    t_dictSuspended[method]=RpcTracer::NowMicros()+kDictSuspendUs;
+}
+
+static bool DictionarySuspended(const google::protobuf::MethodDescriptor *method)
+{
+    if(t_dictSuspended.empty())
+    {
+        return false;
+    }
+    auto it=t_dictSuspended.find(method);
+    if(it==t_dictSuspended.end())
+    {
+        return false;
+    }
+    if(it->second<=RpcTracer::NowMicros())
+    {
+        t_dictSuspended.erase(it);
+        return false;
+    }
+    return true;
+}
+
 void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
                           google::protobuf::RpcController* controller, 
                           const google::protobuf::Message* request,
@@ -22,14 +196,45 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
     std::string service_name=sd->name();//service_name
     std::string method_name=method->name();//method_name
 
-    //获取参数的序列化字符串长度 args_size
-    uint32_t args_size=0;
-    std::string args_str;
-    if(request->SerializeToString(&args_str))
+    //调用方流和双向流需要边写边读，只能通过MprpcStreamChannel调用
+    if(method->client_streaming())
+    {
+        controller->SetFailed("client streaming method requires MprpcStreamChannel!");
+        return;
+    }
+
+    //服务由本进程的RpcProvider发布时直接调用，不经过网络
+    if(RpcLocalRegistry::GetInstance().Call(method,controller,request,response))
     {
-        args_size=args_str.size();
+        return;
     }
-    else
+
+    //服务端流式方法需要调用方提供接收消息的回调
+    RpcStreamController *streamController=nullptr;
+    if(method->server_streaming())
+    {
+        streamController=dynamic_cast<RpcStreamController*>(controller);
+        if(streamController==nullptr)
+        {
+            controller->SetFailed("server streaming method requires RpcStreamController!");
+            return;
+        }
+    }
+
+    CallTraceGuard guard;
+    RpcTraceRecord &trace=guard.trace;
+    if(guard.sampled)
+    {
+        memset(&trace,0,sizeof(trace));
+        trace.side='C';
+        trace.status=-1;
+        trace.start_us=RpcTracer::NowMicros();
+        trace.SetName(service_name,method_name);
+    }
+
+    //序列化参数
+    std::string args_str;
+    if(!request->SerializeToString(&args_str))
     {
         controller->SetFailed("Serialize request error!");
         return;
@@ -40,46 +245,71 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
     mprpc::RpcHeader rpcHeader;
     rpcHeader.set_service_name(service_name);
     rpcHeader.set_method_name(method_name);
-    rpcHeader.set_arg_size(args_size);
-
-    std::string rpc_header_str;
-    if(rpcHeader.SerializeToString(&rpc_header_str))
+    //按方法的压缩策略压缩参数，同时声明本进程能解压的算法，provider据此决定是否压缩响应
+    //rpc_dict_capture_dir：抓取未压缩的请求和响应，用dicttrainer离线训练字典
+    if(RpcCompressor::Capturing())
     {
-        header_size=rpc_header_str.size();
+        RpcCompressor::Capture(service_name,method_name,args_str);
     }
-    else
+    const RpcCompressPolicy &compress=RpcCompressor::PolicyFor(method);
+    rpcHeader.set_accept_compression(RpcCompressor::kSupported);
+    rpcHeader.set_accept_dict_id(compress.dict_id);
+    //请求id在进程内递增，provider在响应中原样带回
+    static std::atomic<uint64_t> next_request_id(1);
+    uint64_t request_id=next_request_id.fetch_add(1,std::memory_order_relaxed);
+    rpcHeader.set_request_id(request_id);
+    //rpc_client_id：调用方标识，provider按它限流
+    rpcHeader.set_client_id(MprpcApplication::GetInstance().GetConfig().Load("rpc_client_id"));
+    if(streamController!=nullptr)
     {
-        controller->SetFailed("Serialize rpc header error!");
-        return;
+        rpcHeader.set_window(streamController->Window());
     }
 
-    //组织待发送的rpc请求字符串
+    //组织待发送的rpc请求字符串：4字节header长度 + rpcheader + args，args按policy压缩
     std::string send_rpc_str;
-    uint32_t net_header_size = htonl(header_size);  // 主机序转网络序
-    send_rpc_str.insert(0, std::string(reinterpret_cast<const char*>(&net_header_size), 4));
-    // send_rpc_str.insert(0,std::string((char*)&header_size,4));//header_size
-    send_rpc_str+=rpc_header_str;//rpcheader
-    send_rpc_str+=args_str;//args
-
-    //std::cout << "send_rpc_str: " << send_rpc_str << std::endl;
-
-    //打印调试信息
-    std::cout<<"============================="<<std::endl;
-    std::cout<<"head_size:"<<header_size<<std::endl;
-    std::cout<<"rpc_header_str:"<<rpc_header_str<<std::endl;
-    std::cout<<"service_name:"<<service_name<<std::endl;
-    std::cout<<"method_name:"<<method_name<<std::endl;
-    std::cout<<"args_size:"<<args_size<<std::endl;
-    std::cout<<"args_str:"<<args_str<<std::endl;
-    std::cout<<"============================="<<std::endl;
-
-    //使用tcp编程，完成rpc方法的远程调用
-    int clientfd=socket(AF_INET,SOCK_STREAM,0);
-    if(clientfd==-1)
-    {
-        char errText[512]={0};
-        sprintf(errText,"create socket error!errno:%d",errno);
-        controller->SetFailed(errText);
+    auto build_request=[&](const RpcCompressPolicy &policy)->bool
+    {
+        std::string compressed_args;
+        const std::string *args=&args_str;
+        if(streamController==nullptr&&RpcCompressor::Compress(policy,args_str.data(),args_str.size(),&compressed_args))
+        {
+            rpcHeader.set_compression(policy.codec);
+            rpcHeader.set_raw_size(args_str.size());
+            rpcHeader.set_dict_id(policy.dict_id);
+            args=&compressed_args;
+        }
+        else
+        {
+            rpcHeader.clear_compression();
+            rpcHeader.clear_raw_size();
+            rpcHeader.clear_dict_id();
+        }
+        rpcHeader.set_arg_size(args->size());
+
+        std::string rpc_header_str;
+        if(!rpcHeader.SerializeToString(&rpc_header_str))
+        {
+            controller->SetFailed("Serialize rpc header error!");
+            return false;
+        }
+        header_size=rpc_header_str.size();
+        uint32_t net_header_size = htonl(header_size);  // 主机序转网络序
+        send_rpc_str.assign(reinterpret_cast<const char*>(&net_header_size), 4);
+        send_rpc_str+=rpc_header_str;//rpcheader
+        send_rpc_str+=*args;//args
+        trace.header_size=header_size;
+        trace.args_size=args->size();
+        return true;
+    };
+    //provider拒绝过这个方法的字典时，本线程暂时不用字典压缩请求
+    RpcCompressPolicy request_compress=compress;
+    if(request_compress.dict_id!=0&&DictionarySuspended(method))
+    {
+        request_compress.dict_id=0;
+        request_compress.dict=nullptr;
+    }
+    if(!build_request(request_compress))
+    {
         return;
     }
 
@@ -87,8 +317,14 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
     //uint16_t port=atoi(MprpcApplication::GetInstance().GetConfig().Load("rpcserverport").c_str());
 
     //配置nginx
-    std::string nginx_ip = MprpcApplication::GetInstance().GetConfig().Load("nginxip");
-    uint16_t nginx_port = atoi(MprpcApplication::GetInstance().GetConfig().Load("nginxport").c_str());
+    RpcEndpoint endpoint;
+    endpoint.ip = MprpcApplication::GetInstance().GetConfig().Load("nginxip");
+    endpoint.port = atoi(MprpcApplication::GetInstance().GetConfig().Load("nginxport").c_str());
+    //同机的provider优先走unix socket
+    if(m_preferUnix)
+    {
+        endpoint.unix_path=ResolveUnixPath(service_name,method_name);
+    }
 
     // ZkClient zkCli;
     // zkCli.Start();
@@ -109,55 +345,220 @@ void MprpcChannel::CallMethod(const google::protobuf::MethodDescriptor* method,
     // std::string ip=host_data.substr(0,idx);
     // uint16_t port=atoi(host_data.substr(idx+1,host_data.size()-idx).c_str());
 
-    struct sockaddr_in server_addr;
-    server_addr.sin_family=AF_INET;
-    server_addr.sin_port=htons(nginx_port);
-    server_addr.sin_addr.s_addr=inet_addr(nginx_ip.c_str());
+    //服务端过载或正在下线时重新建立连接重试，nginx会把新的连接分配给其他节点
+    std::string max_retries_str=MprpcApplication::GetInstance().GetConfig().Load("rpc_max_retries");
+    int max_retries=max_retries_str.empty() ? 2 : atoi(max_retries_str.c_str());
+    for(int attempt=0;;attempt++)
+    {
+        //每个方法在每个目标地址上的并发上限按RTT自适应调整，超出上限的调用不发出去，直接以过载失败
+        RpcConcurrencyLimiter &limiter=RpcConcurrencyLimiter::GetInstance();
+        RpcConcurrencyLimiter::Target *limitTarget=nullptr;
+        std::string limitKey;
+        if(limiter.Enabled())
+        {
+            limitKey=service_name+"."+method_name+"@"+
+                (!endpoint.unix_path.empty() ? endpoint.unix_path : endpoint.ip+":"+std::to_string(endpoint.port));
+            limitTarget=limiter.Acquire(limitKey);
+            if(limitTarget==nullptr)
+            {
+                controller->SetFailed("client concurrency limit reached for "+limitKey+"!");
+                MprpcController *mprpcController=dynamic_cast<MprpcController*>(controller);
+                if(mprpcController!=nullptr)
+                {
+                    mprpcController->SetErrorCode(mprpc::RPC_OVERLOADED);
+                }
+                trace.status=mprpc::RPC_OVERLOADED;
+                break;
+            }
+        }
+
+        uint32_t response_size=0;
+        int64_t call_start_us=RpcTracer::NowMicros();
+        int status=streamController!=nullptr
+            ? SendAndRecvStream(endpoint,send_rpc_str,request_id,response,streamController,&response_size)
+            : SendAndRecv(endpoint,send_rpc_str,request_id,response,controller,&response_size);
+        if(limitTarget!=nullptr)
+        {
+            //流式调用的时长取决于消息条数，不作为RTT样本
+            int64_t rtt_us=streamController!=nullptr ? 0 : std::max<int64_t>(RpcTracer::NowMicros()-call_start_us,1);
+            limiter.Release(limitTarget,rtt_us,status);
+        }
+        trace.status=status;
+        if(status==mprpc::RPC_OK&&streamController==nullptr&&RpcCompressor::Capturing())
+        {
+            RpcCompressor::Capture(service_name,method_name,response->SerializeAsString());
+        }
+        trace.response_size=response_size;
+        if(status==mprpc::RPC_UNKNOWN_DICT&&rpcHeader.dict_id()!=0)
+        {
+            //provider还没有加载这个字典(字典文件不一致，或者新发布的字典还没有被它监听到)，
+            //不用字典重新压缩后立即重发，不占用重试次数
+            SuspendDictionary(method);
+            RpcCompressPolicy plain=compress;
+            plain.dict_id=0;
+            plain.dict=nullptr;
+            controller->Reset();
+            if(!build_request(plain))
+            {
+                break;
+            }
+            attempt--;
+            continue;
+        }
+        bool retryable=status==mprpc::RPC_OVERLOADED||status==mprpc::RPC_UNAVAILABLE;
+        if(!retryable||attempt>=max_retries)
+        {
+            break;
+        }
+        controller->Reset();
+        //本机provider过载或下线时通过nginx换一个节点重试
+        endpoint.unix_path.clear();
+    }
+}
 
-    //连接rpc服务节点
-    if(-1==connect(clientfd,(sockaddr *)&server_addr,sizeof(server_addr)))
+//服务端拒绝或执行失败，把状态码带给调用方，调用方据此决定是否重试
+static int SetStatus(const mprpc::RpcResponseHeader &header, google::protobuf::RpcController *controller)
+{
+    controller->SetFailed(header.error_text());
+    MprpcController *mprpcController=dynamic_cast<MprpcController*>(controller);
+    if(mprpcController!=nullptr)
     {
-        close(clientfd);
-        char errText[512]={0};
-        sprintf(errText,"connect error!errno:%d",errno);
-        controller->SetFailed(errText);
-        return;
+        mprpcController->SetErrorCode(header.status());
     }
+    return header.status();
+}
 
-    //发送字节流数据
-    if(-1==send(clientfd,send_rpc_str.c_str(),send_rpc_str.size(),0))
+//检查收到的响应帧并反序列化响应数据
+static int FinishCall(const mprpc::RpcResponseHeader &responseHeader, const char *body, size_t body_size,
+                      uint64_t request_id, google::protobuf::Message *response,
+                      google::protobuf::RpcController *controller, uint32_t *response_size)
+{
+    *response_size=body_size;
+
+    if(responseHeader.request_id()!=request_id)
     {
-        close(clientfd);
-        char errText[512]={0};
-        sprintf(errText,"send error!errno:%d",errno);
-        controller->SetFailed(errText);
-        return;
+        controller->SetFailed("response request id mismatch!");
+        return -1;
     }
 
-    //接收rpc请求的响应值
-    char recv_buf[1024]={0};
-    int recv_size=0;
-    if(-1==(recv_size=recv(clientfd,recv_buf,1024,0)))
+    if(responseHeader.status()!=mprpc::RPC_OK)
     {
-        close(clientfd);
-        char errText[512]={0};
-        sprintf(errText,"recv error!errno:%d",errno);
-        controller->SetFailed(errText);
-        return;
+        return SetStatus(responseHeader,controller);
+    }
+
+    //压缩的响应先解压到本线程的缓冲区，解析完缓冲区过大就释放
+    thread_local std::string raw_body;
+    bool decompressed=responseHeader.compression()!=mprpc::COMPRESS_NONE;
+    if(decompressed)
+    {
+        if(!RpcCompressor::Decompress(responseHeader.compression(),responseHeader.dict_id(),body,body_size,
+                                      responseHeader.raw_size(),&raw_body))
+        {
+            RpcCompressor::ReleaseBuffer(&raw_body);
+            controller->SetFailed("response decompress error!");
+            return -1;
+        }
+        body=raw_body.data();
+        body_size=raw_body.size();
     }
 
     //反序列化rpc调用的响应数据
-    //std::string response_str(recv_buf,0,recv_size);//bug出现问题，recv_buf中遇到\0后面的数据就存不下来了，导致反序列化失败
-    //if(!response->ParseFromString(response_str))
-    if(!response->ParseFromArray(recv_buf,recv_size))
-    {
-        close(clientfd);
-        char errText[512]={0};
-        snprintf(errText, sizeof(errText), 
-         "response parse error,response_str:%s", recv_buf);
-        controller->SetFailed(errText);
-        return;
+    bool parsed=response->ParseFromArray(body,body_size);
+    if(decompressed)
+    {
+        RpcCompressor::ReleaseBuffer(&raw_body);
+    }
+    if(!parsed)
+    {
+        controller->SetFailed("response parse error!");
+        return -1;
+    }
+    return mprpc::RPC_OK;
+}
+
+int MprpcChannel::SendAndRecv(const RpcEndpoint &endpoint, const std::string &send_rpc_str, uint64_t request_id,
+                              google::protobuf::Message *response, google::protobuf::RpcController *controller,
+                              uint32_t *response_size)
+{
+    std::unique_ptr<RpcClientConnection> conn=m_transport->Connect(endpoint,controller);
+    if(!conn||!conn->WriteFrame(send_rpc_str,controller))
+    {
+        return -1;
     }
 
-    close(clientfd);
-}
\ No newline at end of file
+    mprpc::RpcResponseHeader responseHeader;
+    std::string response_str;
+    bool received=conn->ReadFrame(&responseHeader,&response_str,controller);
+    conn.reset();
+    if(!received)
+    {
+        return -1;
+    }
+    return FinishCall(responseHeader,response_str.data(),response_str.size(),request_id,response,controller,response_size);
+}
+
+int MprpcChannel::SendAndRecvStream(const RpcEndpoint &endpoint, const std::string &send_rpc_str, uint64_t request_id,
+                                    google::protobuf::Message *response, RpcStreamController *controller,
+                                    uint32_t *response_size)
+{
+    //函数返回时连接随之断开
+    std::unique_ptr<RpcClientConnection> conn=m_transport->Connect(endpoint,controller);
+    if(!conn||!conn->WriteFrame(send_rpc_str,controller))
+    {
+        return -1;
+    }
+
+    //每处理完半个窗口的消息就把这部分配额还给provider，provider最多领先window条消息
+    uint32_t consumed=0;
+    uint32_t refill=controller->Window()/2>0 ? controller->Window()/2 : 1;
+    for(;;)
+    {
+        mprpc::RpcResponseHeader responseHeader;
+        std::string body;
+        if(!conn->ReadFrame(&responseHeader,&body,controller))
+        {
+            return -1;
+        }
+        if(responseHeader.request_id()!=request_id)
+        {
+            controller->SetFailed("response request id mismatch!");
+            return -1;
+        }
+        *response_size+=body.size();
+
+        if(responseHeader.frame_type()!=mprpc::FRAME_MESSAGE)
+        {
+            //结束帧，或者provider在开始流之前就拒绝了请求
+            return responseHeader.status()==mprpc::RPC_OK ? mprpc::RPC_OK : SetStatus(responseHeader,controller);
+        }
+
+        response->Clear();
+        if(!response->ParseFromString(body))
+        {
+            controller->SetFailed("response parse error!");
+            return -1;
+        }
+        if(!controller->OnMessage(*response))
+        {
+            //调用方不再需要后续消息，断开连接让provider取消流
+            return mprpc::RPC_OK;
+        }
+
+        if(++consumed>=refill)
+        {
+            mprpc::RpcHeader windowHeader;
+            windowHeader.set_request_id(request_id);
+            windowHeader.set_frame_type(mprpc::FRAME_WINDOW);
+            windowHeader.set_window(consumed);
+            std::string header_str=windowHeader.SerializeAsString();
+            uint32_t net_header_size=htonl(header_str.size());
+            std::string frame(reinterpret_cast<const char*>(&net_header_size),4);
+            frame+=header_str;
+            if(!conn->WriteFrame(frame,controller))
+            {
+                return -1;
+            }
+            consumed=0;
+        }
+    }
+}
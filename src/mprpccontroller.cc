@@ -4,12 +4,14 @@ MprpcController::MprpcController()
 {
     m_failed = false;
     m_errText = "";
+    m_errCode = 0;
 }
 
 void MprpcController::Reset()
 {
     m_failed = false;
     m_errText = "";
+    m_errCode = 0;
 }
 
 bool MprpcController::Failed() const
@@ -24,10 +26,20 @@ std::string MprpcController::ErrorText() const
 
 void MprpcController::SetFailed(const std::string &reason)
 {
-    m_failed = false;
+    m_failed = true;
     m_errText = reason;
 }
 
+void MprpcController::SetErrorCode(int code)
+{
+    m_errCode = code;
+}
+
+int MprpcController::ErrorCode() const
+{
+    return m_errCode;
+}
+
 void MprpcController::StartCancel(){}
 bool MprpcController::IsCanceled() const{return false;}
 void MprpcController::NotifyOnCancel(google::protobuf::Closure *callback){}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "mprpcshmchannel.h"
+#include "mprpcapplication.h"
+#include "mprpccontroller.h"
+#include "rpcheader.pb.h"
+#include "rpchotrestart.h"
+#include "rpctracer.h"
+#include "logger.h"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+MprpcShmChannel::MprpcShmChannel() : m_sock(-1), m_nextId(1)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    m_busyPollUs = atoi(config.Load("rpc_shm_busy_poll_us").c_str());
+    int timeout_ms = atoi(config.Load("rpc_shm_timeout_ms").c_str());
+    m_timeoutMs = timeout_ms > 0 ? timeout_ms : 5000;
+}
+
+MprpcShmChannel::~MprpcShmChannel()
+{
+    if (m_sock != -1)
+    {
+        close(m_sock);
+    }
+}
+
+bool MprpcShmChannel::Connect()
+{
+    return Connect(MprpcApplication::GetConfig().Load("rpc_shm_path"));
+}
+
+bool MprpcShmChannel::Connect(const std::string &path)
+{
+    return OpenSession(path, &m_sock, &m_segment);
+}
+
+bool MprpcShmChannel::OpenSession(const std::string &path, int *sock_out, std::unique_ptr<RpcShmSegment> *segment_out)
+{
+    int sock = RpcHotRestart::Connect(path);
+    if (sock == -1)
+    {
+        LOG_ERR("connect shm path %s error! errno:%d", path.c_str(), errno);
+        return false;
+    }
+
+    // provider依次发来共享内存、请求队列和响应队列的eventfd
+    int fds[3] = {-1, -1, -1};
+    RpcHotRestart::MessageType expected[3] = {RpcHotRestart::kShmSegment, RpcHotRestart::kShmEvent, RpcHotRestart::kShmEvent};
+    bool ok = true;
+    for (int i = 0; i < 3 && ok; i++)
+    {
+        RpcHotRestart::MessageType type;
+        std::string data;
+        ok = RpcHotRestart::Recv(sock, &type, &data, &fds[i]) && type == expected[i];
+    }
+    std::unique_ptr<RpcShmSegment> segment(new RpcShmSegment);
+    // Attach之后fd归segment所有，失败时由segment关闭
+    if (!ok || !segment->Attach(fds[0], fds[1], fds[2]))
+    {
+        LOG_ERR("shm session setup with %s failed", path.c_str());
+        if (!ok)
+        {
+            for (int fd : fds)
+            {
+                if (fd != -1)
+                {
+                    close(fd);
+                }
+            }
+        }
+        close(sock);
+        return false;
+    }
+    *sock_out = sock;
+    *segment_out = std::move(segment);
+    return true;
+}
+
+bool MprpcShmChannel::Closed()
+{
+    char c;
+    ssize_t n = recv(m_sock, &c, 1, MSG_DONTWAIT | MSG_PEEK);
+    return n == 0 || (n == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+}
+
+void MprpcShmChannel::CallMethod(const google::protobuf::MethodDescriptor *method,
+                                 google::protobuf::RpcController *controller,
+                                 const google::protobuf::Message *request,
+                                 google::protobuf::Message *response,
+                                 google::protobuf::Closure *done)
+{
+    if (method->client_streaming() || method->server_streaming())
+    {
+        controller->SetFailed("streaming method is not supported over shared memory!");
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_segment)
+    {
+        controller->SetFailed("shm channel is not connected!");
+        return;
+    }
+
+    uint64_t request_id = m_nextId++;
+    mprpc::RpcHeader rpcHeader;
+    rpcHeader.set_service_name(method->service()->name());
+    rpcHeader.set_method_name(method->name());
+    rpcHeader.set_arg_size(request->ByteSizeLong());
+    rpcHeader.set_request_id(request_id);
+    rpcHeader.set_client_id(MprpcApplication::GetConfig().Load("rpc_client_id"));
+    uint32_t header_size = rpcHeader.ByteSizeLong();
+    uint32_t len = 4 + header_size + rpcHeader.arg_size();
+
+    // 请求帧直接构造在共享内存中，格式和TCP上的请求帧相同
+    RpcShmRing &requests = m_segment->Requests();
+    char *frame = requests.Reserve(len, m_timeoutMs);
+    if (frame == nullptr)
+    {
+        controller->SetFailed("shm request ring is full or request too large!");
+        return;
+    }
+    uint32_t net_header_size = htonl(header_size);
+    memcpy(frame, &net_header_size, 4);
+    uint8_t *out = rpcHeader.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(frame + 4));
+    request->SerializeWithCachedSizesToArray(out);
+    requests.Commit(len);
+
+    // 等待响应，之前超时的调用的响应可能还留在队列里，按request_id跳过
+    RpcShmRing &responses = m_segment->Responses();
+    int64_t deadline_us = RpcTracer::NowMicros() + static_cast<int64_t>(m_timeoutMs) * 1000;
+    for (;;)
+    {
+        if (!responses.Wait(m_busyPollUs, 100))
+        {
+            if (Closed())
+            {
+                controller->SetFailed("shm session closed by provider!");
+                return;
+            }
+            if (RpcTracer::NowMicros() >= deadline_us)
+            {
+                controller->SetFailed("shm call timeout!");
+                return;
+            }
+            continue;
+        }
+
+        uint32_t frame_len = 0;
+        const char *data = responses.Peek(&frame_len);
+        if (data == nullptr)
+        {
+            if (responses.Corrupted())
+            {
+                controller->SetFailed("shm responce ring corrupted!");
+                return;
+            }
+            continue;
+        }
+        mprpc::RpcResponseHeader responseHeader;
+        uint32_t response_header_size = 0;
+        if (frame_len >= 4)
+        {
+            memcpy(&response_header_size, data, 4);
+            response_header_size = ntohl(response_header_size);
+        }
+        if (frame_len < 4 || response_header_size > frame_len - 4 ||
+            !responseHeader.ParseFromArray(data + 4, response_header_size) ||
+            responseHeader.body_size() != frame_len - 4 - response_header_size)
+        {
+            responses.Consume(frame_len);
+            controller->SetFailed("shm responce header parse error!");
+            return;
+        }
+        if (responseHeader.request_id() != request_id)
+        {
+            responses.Consume(frame_len);
+            continue;
+        }
+
+        // 响应直接从共享内存中解析，解析完才释放这段内存
+        if (responseHeader.status() != mprpc::RPC_OK)
+        {
+            controller->SetFailed(responseHeader.error_text());
+            MprpcController *mprpcController = dynamic_cast<MprpcController *>(controller);
+            if (mprpcController != nullptr)
+            {
+                mprpcController->SetErrorCode(responseHeader.status());
+            }
+        }
+        else if (!response->ParseFromArray(data + 4 + response_header_size, responseHeader.body_size()))
+        {
+            controller->SetFailed("response parse error!");
+        }
+        responses.Consume(frame_len);
+        return;
+    }
+}
@@ -0,0 +1,433 @@
+#include "mprpcstreamchannel.h"
+#include "mprpcapplication.h"
+#include "rpcheader.pb.h"
+#include "rpcclienttransport.h"
+#include "logger.h"
+
+#include <cstring>
+#include <cerrno>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+// 流式连接的socket，多个流共用，发送时整帧加锁。
+// 发送方临时持有强引用，channel析构时即使还有流在发送，socket也要等发送结束、最后一个引用释放后才关闭
+struct MprpcStreamConnection
+{
+    int fd;
+    std::mutex sendMutex;
+
+    explicit MprpcStreamConnection(int fd) : fd(fd) {}
+    ~MprpcStreamConnection() { close(fd); }
+    bool SendFrame(const mprpc::RpcHeader &header, const std::string &body);
+};
+
+MprpcClientStream::MprpcClientStream(const std::shared_ptr<MprpcStreamConnection> &conn, uint64_t id, uint32_t window)
+    : m_conn(conn),
+      m_id(id),
+      m_window(window == 0 ? kDefaultStreamWindow : window),
+      m_sendWindow(kDefaultStreamWindow),
+      m_consumed(0),
+      m_writesDone(false),
+      m_finished(false),
+      m_status(mprpc::RPC_OK)
+{
+}
+
+MprpcClientStream::~MprpcClientStream()
+{
+    Cancel();
+}
+
+bool MprpcClientStream::Write(const google::protobuf::Message &message)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]() { return m_sendWindow > 0 || m_finished; });
+        if (m_finished || m_writesDone)
+        {
+            return false;
+        }
+        m_sendWindow--;
+    }
+
+    std::string body;
+    if (!message.SerializeToString(&body))
+    {
+        return false;
+    }
+    mprpc::RpcHeader header;
+    header.set_request_id(m_id);
+    header.set_frame_type(mprpc::FRAME_MESSAGE);
+    header.set_arg_size(body.size());
+    return SendFrame(header, body);
+}
+
+bool MprpcClientStream::WritesDone()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_finished || m_writesDone)
+        {
+            return false;
+        }
+        m_writesDone = true;
+    }
+
+    mprpc::RpcHeader header;
+    header.set_request_id(m_id);
+    header.set_frame_type(mprpc::FRAME_END);
+    return SendFrame(header, "");
+}
+
+bool MprpcClientStream::Read(google::protobuf::Message *message)
+{
+    std::string body;
+    uint32_t grant = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]() { return !m_incoming.empty() || m_finished; });
+        if (m_incoming.empty())
+        {
+            return false;
+        }
+        body.swap(m_incoming.front());
+        m_incoming.pop_front();
+
+        // 每处理完半个窗口的消息就把这部分配额还给provider，流结束后不再归还
+        uint32_t refill = m_window / 2 > 0 ? m_window / 2 : 1;
+        if (++m_consumed >= refill && !m_finished)
+        {
+            grant = m_consumed;
+            m_consumed = 0;
+        }
+    }
+    if (grant > 0)
+    {
+        mprpc::RpcHeader header;
+        header.set_request_id(m_id);
+        header.set_frame_type(mprpc::FRAME_WINDOW);
+        header.set_window(grant);
+        SendFrame(header, "");
+    }
+
+    message->Clear();
+    return message->ParseFromString(body);
+}
+
+int MprpcClientStream::Finish(google::protobuf::Message *response)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cond.wait(lock, [this]() { return m_finished; });
+    if (m_status == mprpc::RPC_OK && response != nullptr && !response->ParseFromString(m_finalBody))
+    {
+        m_errorText = "response parse error!";
+        return -1;
+    }
+    return m_status;
+}
+
+void MprpcClientStream::Cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_finished)
+        {
+            return;
+        }
+        m_finished = true;
+        m_status = -1;
+        m_errorText = "stream is canceled";
+    }
+    m_cond.notify_all();
+
+    mprpc::RpcHeader header;
+    header.set_request_id(m_id);
+    header.set_frame_type(mprpc::FRAME_CANCEL);
+    SendFrame(header, "");
+}
+
+bool MprpcClientStream::SendFrame(const mprpc::RpcHeader &header, const std::string &body)
+{
+    std::shared_ptr<MprpcStreamConnection> conn = m_conn.lock();
+    if (!conn)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_finished)
+        {
+            m_finished = true;
+            m_status = -1;
+            m_errorText = "stream channel is closed";
+        }
+        m_cond.notify_all();
+        return false;
+    }
+    return conn->SendFrame(header, body);
+}
+
+void MprpcClientStream::OnMessage(std::string &body)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_incoming.emplace_back();
+        m_incoming.back().swap(body);
+    }
+    m_cond.notify_all();
+}
+
+void MprpcClientStream::OnWindow(uint32_t window)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_sendWindow += window;
+    }
+    m_cond.notify_all();
+}
+
+void MprpcClientStream::OnEnd(int status, const std::string &error_text, std::string &body)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_finished)
+        {
+            // 已经在本地取消，provider随后的结束帧不再改变结果
+            return;
+        }
+        m_finished = true;
+        m_status = status;
+        m_errorText = error_text;
+        m_finalBody.swap(body);
+    }
+    m_cond.notify_all();
+}
+
+MprpcStreamChannel::MprpcStreamChannel() : m_nextId(1), m_closed(false)
+{
+}
+
+MprpcStreamChannel::~MprpcStreamChannel()
+{
+    if (m_conn)
+    {
+        // 关闭连接让读线程退出，未结束的流都以连接错误结束，之后流的写操作都会失败
+        ::shutdown(m_conn->fd, SHUT_RDWR);
+        m_reader.join();
+        m_conn.reset();
+    }
+}
+
+bool MprpcStreamChannel::Connect()
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    return Connect(config.Load("nginxip"), atoi(config.Load("nginxport").c_str()));
+}
+
+bool MprpcStreamChannel::Connect(const std::string &ip, uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd == -1)
+    {
+        LOG_ERR("create socket error! errno:%d", errno);
+        return false;
+    }
+
+    struct sockaddr_in server_addr;
+    server_addr.sin_family = AF_INET;
+    server_addr.sin_port = htons(port);
+    server_addr.sin_addr.s_addr = inet_addr(ip.c_str());
+    if (-1 == connect(fd, (sockaddr *)&server_addr, sizeof(server_addr)))
+    {
+        LOG_ERR("connect %s:%d error! errno:%d", ip.c_str(), port, errno);
+        close(fd);
+        return false;
+    }
+
+    m_conn = std::make_shared<MprpcStreamConnection>(fd);
+    m_reader = std::thread(&MprpcStreamChannel::ReadLoop, this);
+    return true;
+}
+
+std::shared_ptr<MprpcClientStream> MprpcStreamChannel::OpenStream(const google::protobuf::MethodDescriptor *method,
+                                                                  const google::protobuf::Message *request,
+                                                                  uint32_t window)
+{
+    uint64_t id = m_nextId.fetch_add(1, std::memory_order_relaxed);
+    std::shared_ptr<MprpcClientStream> stream(new MprpcClientStream(m_conn, id, window));
+
+    std::string args_str;
+    if (request != nullptr && !request->SerializeToString(&args_str))
+    {
+        std::string empty;
+        stream->OnEnd(-1, "Serialize request error!", empty);
+        return stream;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        if (!m_conn || m_closed)
+        {
+            std::string empty;
+            stream->OnEnd(-1, "stream channel is not connected", empty);
+            return stream;
+        }
+        m_streams[id] = stream;
+    }
+
+    mprpc::RpcHeader header;
+    header.set_service_name(method->service()->name());
+    header.set_method_name(method->name());
+    header.set_arg_size(args_str.size());
+    header.set_request_id(id);
+    header.set_frame_type(mprpc::FRAME_CALL);
+    header.set_window(stream->m_window);
+    header.set_client_id(MprpcApplication::GetConfig().Load("rpc_client_id"));
+    m_conn->SendFrame(header, args_str);
+    return stream;
+}
+
+bool MprpcStreamConnection::SendFrame(const mprpc::RpcHeader &header, const std::string &body)
+{
+    std::string header_str = header.SerializeAsString();
+    uint32_t net_header_size = htonl(header_str.size());
+    std::string frame;
+    frame.reserve(4 + header_str.size() + body.size());
+    frame.append(reinterpret_cast<const char *>(&net_header_size), 4);
+    frame += header_str;
+    frame += body;
+
+    std::lock_guard<std::mutex> lock(sendMutex);
+    size_t sent = 0;
+    while (sent < frame.size())
+    {
+        ssize_t n = send(fd, frame.data() + sent, frame.size() - sent, MSG_NOSIGNAL);
+        if (n == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            // 发送失败时读线程也会收到错误，由它统一结束所有的流
+            LOG_ERR("stream channel send error! errno:%d", errno);
+            return false;
+        }
+        sent += n;
+    }
+    return true;
+}
+
+void MprpcStreamChannel::RemoveStream(uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    m_streams.erase(id);
+}
+
+//从socket中读满len个字节，对端关闭或出错时返回false
+static bool RecvAll(int fd, char *buf, size_t len)
+{
+    size_t received = 0;
+    while (received < len)
+    {
+        ssize_t n = recv(fd, buf + received, len - received, 0);
+        if (n <= 0)
+        {
+            if (n == -1 && errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        received += n;
+    }
+    return true;
+}
+
+void MprpcStreamChannel::ReadLoop()
+{
+    int fd = m_conn->fd;
+    for (;;)
+    {
+        uint32_t net_header_size = 0;
+        if (!RecvAll(fd, reinterpret_cast<char *>(&net_header_size), 4))
+        {
+            break;
+        }
+        // 长度都由provider给出，超过上限时断开连接，不按它分配内存
+        uint32_t header_size = ntohl(net_header_size);
+        if (header_size > RpcMaxFrameBytes())
+        {
+            LOG_ERR("stream channel response header too large: %u", header_size);
+            ::shutdown(fd, SHUT_RDWR);
+            break;
+        }
+        std::string header_str(header_size, '\0');
+        mprpc::RpcResponseHeader header;
+        if (!RecvAll(fd, &header_str[0], header_str.size()) || !header.ParseFromString(header_str))
+        {
+            break;
+        }
+        if (4 + static_cast<size_t>(header_size) + header.body_size() > RpcMaxFrameBytes())
+        {
+            LOG_ERR("stream channel response frame too large: %u", header.body_size());
+            ::shutdown(fd, SHUT_RDWR);
+            break;
+        }
+        std::string body(header.body_size(), '\0');
+        if (!RecvAll(fd, &body[0], body.size()))
+        {
+            break;
+        }
+
+        std::shared_ptr<MprpcClientStream> stream;
+        {
+            std::lock_guard<std::mutex> lock(m_streamMutex);
+            auto it = m_streams.find(header.request_id());
+            if (it != m_streams.end())
+            {
+                stream = it->second.lock();
+                // 调用方已经释放了这个流，析构时发出的取消帧让provider结束它，结束帧到达时删除表项
+                if (!stream && header.frame_type() != mprpc::FRAME_MESSAGE && header.frame_type() != mprpc::FRAME_WINDOW)
+                {
+                    m_streams.erase(it);
+                }
+            }
+        }
+        if (!stream)
+        {
+            continue;
+        }
+
+        switch (header.frame_type())
+        {
+        case mprpc::FRAME_MESSAGE:
+            stream->OnMessage(body);
+            break;
+        case mprpc::FRAME_WINDOW:
+            stream->OnWindow(header.window());
+            break;
+        default:
+            // 结束帧，或者provider在开始流之前就拒绝了请求
+            RemoveStream(stream->Id());
+            stream->OnEnd(header.status(), header.error_text(), body);
+            break;
+        }
+    }
+
+    // 连接断开，所有未结束的流以连接错误结束
+    std::unordered_map<uint64_t, std::weak_ptr<MprpcClientStream>> streams;
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        m_closed = true;
+        streams.swap(m_streams);
+    }
+    for (auto &sp : streams)
+    {
+        std::shared_ptr<MprpcClientStream> stream = sp.second.lock();
+        if (stream)
+        {
+            std::string empty;
+            stream->OnEnd(-1, "stream channel connection closed", empty);
+        }
+    }
+}
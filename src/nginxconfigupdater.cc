@@ -115,6 +115,8 @@ void NginxConfigUpdater::UpdateConfig(const std::string& trigger) {
             std::string full_path = watch_path_ + "/" + node;
             std::string node_data = zk_client_.GetData(full_path.c_str());
             if (!node_data.empty()) {
+                // 节点数据为"ip:port"，后面可能带有" unix=路径"，nginx只需要TCP地址
+                node_data = node_data.substr(0, node_data.find(' '));
                 // 验证节点数据格式
                 if (node_data.find(':') != std::string::npos) {
                     LOG_INFO("Found valid provider: %s", node_data.c_str());
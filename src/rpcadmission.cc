@@ -0,0 +1,88 @@
+#include "rpcadmission.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <cstdlib>
+
+RpcAdmissionController::RpcAdmissionController()
+    : m_maxInflight(0), m_targetUs(0), m_intervalUs(100 * 1000)
+{
+}
+
+void RpcAdmissionController::Init()
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+
+    // admission_max_inflight：同时处理中的请求上限，默认不限制
+    m_maxInflight = atoi(config.Load("admission_max_inflight").c_str());
+    // admission_target_ms：可接受的排队延迟，默认关闭；admission_interval_ms：观测窗口，默认100ms
+    m_targetUs = atoi(config.Load("admission_target_ms").c_str()) * 1000;
+    int interval_ms = atoi(config.Load("admission_interval_ms").c_str());
+    if (interval_ms > 0)
+    {
+        m_intervalUs = interval_ms * 1000;
+    }
+
+    LOG_INFO("admission control max inflight:%d target:%ldus interval:%ldus",
+             m_maxInflight, m_targetUs, m_intervalUs);
+}
+
+bool RpcAdmissionController::Overloaded(int64_t queue_delay_us, int64_t now_us, RpcPriority priority)
+{
+    if (m_targetUs == 0)
+    {
+        return false;
+    }
+
+    // 观测窗口结束时，用窗口内的最小延迟判断是否积压，然后开启新的窗口
+    int64_t interval_end = m_intervalEnd.load(std::memory_order_relaxed);
+    if (now_us > interval_end &&
+        m_intervalEnd.compare_exchange_strong(interval_end, now_us + m_intervalUs))
+    {
+        int64_t min_delay = m_minDelay.exchange(INT64_MAX);
+        m_overloaded.store(min_delay > m_targetUs, std::memory_order_relaxed);
+    }
+
+    int64_t min_delay = m_minDelay.load(std::memory_order_relaxed);
+    while (queue_delay_us < min_delay &&
+           !m_minDelay.compare_exchange_weak(min_delay, queue_delay_us))
+    {
+    }
+
+    if (!m_overloaded.load(std::memory_order_relaxed) || priority == RPC_PRIORITY_CRITICAL)
+    {
+        return false;
+    }
+    // 积压状态下普通请求只拒绝排队超过2倍target的，尽量保住还能按时完成的请求
+    if (priority == RPC_PRIORITY_SHEDDABLE || queue_delay_us > 2 * m_targetUs)
+    {
+        m_rejected.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+bool RpcAdmissionController::Admit(int64_t queue_delay_us, int64_t now_us, RpcPriority priority)
+{
+    if (Overloaded(queue_delay_us, now_us, priority))
+    {
+        return false;
+    }
+    return TryAcquire();
+}
+
+bool RpcAdmissionController::TryAcquire()
+{
+    int inflight = m_inflight.fetch_add(1, std::memory_order_relaxed);
+    if (m_maxInflight > 0 && inflight >= m_maxInflight)
+    {
+        m_inflight.fetch_sub(1, std::memory_order_relaxed);
+        m_rejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void RpcAdmissionController::Release()
+{
+    m_inflight.fetch_sub(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,140 @@
+#include "rpcaffinity.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+
+std::vector<int> ParseCpuList(const std::string &list)
+{
+    std::vector<int> cpus;
+    size_t start = 0;
+    while (start < list.size())
+    {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = list.size();
+        }
+        std::string item = list.substr(start, end - start);
+        size_t dash = item.find('-');
+        if (dash == std::string::npos)
+        {
+            if (!item.empty())
+            {
+                cpus.push_back(atoi(item.c_str()));
+            }
+        }
+        else
+        {
+            int first = atoi(item.substr(0, dash).c_str());
+            int last = atoi(item.substr(dash + 1).c_str());
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        start = end + 1;
+    }
+    return cpus;
+}
+
+int NumaNodeOfCpu(int cpu)
+{
+    // /sys/devices/system/cpu/cpuN/目录下有一个nodeX的链接指向所在的numa节点
+    std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr)
+    {
+        return -1;
+    }
+    int node = -1;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        if (strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9')
+        {
+            node = atoi(entry->d_name + 4);
+            break;
+        }
+    }
+    closedir(dir);
+    return node;
+}
+
+RpcAffinity &RpcAffinity::GetInstance()
+{
+    static RpcAffinity affinity;
+    return affinity;
+}
+
+RpcAffinity::RpcAffinity()
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    m_cpus["io"] = ParseCpuList(config.Load("rpc_io_cpus"));
+    m_cpus["worker"] = ParseCpuList(config.Load("rpc_worker_cpus"));
+    m_numaLocal = config.Load("rpc_numa_local") == "true";
+}
+
+void RpcAffinity::BindCurrentThread(const std::string &role)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    int index = m_nextIndex[role]++;
+
+    ThreadEntry entry;
+    entry.name = role + "-" + std::to_string(index);
+    entry.tid = static_cast<int>(syscall(SYS_gettid));
+    entry.cpu = -1;
+    entry.node = -1;
+
+    const std::vector<int> &cpus = m_cpus[role];
+    if (!cpus.empty())
+    {
+        int cpu = cpus[index % cpus.size()];
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu, &cpuset);
+        int rc = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+        if (rc != 0)
+        {
+            LOG_ERR("bind %s to cpu %d error! errno:%d", entry.name.c_str(), cpu, rc);
+        }
+        else
+        {
+            entry.cpu = cpu;
+            entry.node = NumaNodeOfCpu(cpu);
+        }
+    }
+
+    // 线程固定在一个核心上之后，让它之后分配的内存(连接缓冲区、请求对象等)都落在本地numa节点
+    if (m_numaLocal && entry.node >= 0)
+    {
+        unsigned long nodemask = 1UL << entry.node;
+        if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodemask, sizeof(nodemask) * 8 + 1) == -1)
+        {
+            LOG_ERR("set mempolicy of %s to node %d error! errno:%d", entry.name.c_str(), entry.node, errno);
+        }
+    }
+
+    m_layout.push_back(entry);
+}
+
+void RpcAffinity::Report()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::cout << "Thread layout (numa_local=" << (m_numaLocal ? "true" : "false") << "):" << std::endl;
+    for (const ThreadEntry &entry : m_layout)
+    {
+        std::string cpu = entry.cpu < 0 ? "any" : std::to_string(entry.cpu);
+        std::string node = entry.node < 0 ? "any" : std::to_string(entry.node);
+        std::cout << "  " << entry.name << " tid:" << entry.tid << " cpu:" << cpu << " node:" << node << std::endl;
+        LOG_INFO("thread %s tid:%d cpu:%s node:%s", entry.name.c_str(), entry.tid, cpu.c_str(), node.c_str());
+    }
+}
@@ -0,0 +1,96 @@
+#include "rpcalias.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::internal::WireFormatLite;
+
+bool RpcAliasController::Parse(const char *data, size_t size, size_t min_bytes, bool copy_input,
+                               google::protobuf::Message *request)
+{
+    if (copy_input)
+    {
+        m_input.assign(data, size);
+        data = m_input.data();
+    }
+
+    // 按线格式遍历顶层字段，被引用的字段从数据中剔除，剩下的片段拼起来交给protobuf解析
+    const google::protobuf::Descriptor *descriptor = request->GetDescriptor();
+    google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t *>(data), size);
+    std::string rest;
+    const char *segment = data;
+    for (;;)
+    {
+        const char *field_start = data + input.CurrentPosition();
+        uint32_t tag = input.ReadTag();
+        if (tag == 0)
+        {
+            break;
+        }
+        if (WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+        {
+            if (!WireFormatLite::SkipField(&input, tag))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        uint32_t length = 0;
+        if (!input.ReadVarint32(&length) || length > size - input.CurrentPosition())
+        {
+            return false;
+        }
+        const FieldDescriptor *field = descriptor->FindFieldByNumber(WireFormatLite::GetTagFieldNumber(tag));
+        if (field != nullptr && !field->is_repeated() && length >= min_bytes &&
+            (field->type() == FieldDescriptor::TYPE_BYTES || field->type() == FieldDescriptor::TYPE_STRING))
+        {
+            rest.append(segment, field_start - segment);
+            const char *value = data + input.CurrentPosition();
+            // 同一个字段出现多次时以最后一次为准，和protobuf的合并规则一致
+            bool found = false;
+            for (auto &f : m_fields)
+            {
+                if (f.number == field->number())
+                {
+                    f.data = value;
+                    f.size = length;
+                    found = true;
+                }
+            }
+            if (!found)
+            {
+                m_fields.push_back({field->number(), value, length});
+            }
+            segment = value + length;
+        }
+        input.Skip(length);
+    }
+    if (input.CurrentPosition() != static_cast<int>(size))
+    {
+        return false;
+    }
+
+    if (segment == data)
+    {
+        // 没有字段被引用，直接解析原始数据
+        return request->ParseFromArray(data, size);
+    }
+    rest.append(segment, data + size - segment);
+    return request->ParseFromString(rest);
+}
+
+bool RpcAliasController::AliasedField(int number, const char **data, size_t *size) const
+{
+    for (const auto &f : m_fields)
+    {
+        if (f.number == number)
+        {
+            *data = f.data;
+            *size = f.size;
+            return true;
+        }
+    }
+    return false;
+}
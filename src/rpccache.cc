@@ -0,0 +1,105 @@
+#include "rpccache.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <cstdlib>
+#include <functional>
+
+RpcResponseCache::RpcResponseCache() : m_shardCapacity(0)
+{
+}
+
+void RpcResponseCache::Init()
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+
+    // response_cache_mb：缓存的内存上限，默认64MB；response_cache_shards：分片数，默认16
+    std::string mb_str = config.Load("response_cache_mb");
+    size_t capacity = (mb_str.empty() ? 64 : atoi(mb_str.c_str())) * 1024UL * 1024UL;
+    int shards = atoi(config.Load("response_cache_shards").c_str());
+    if (shards <= 0)
+    {
+        shards = 16;
+    }
+
+    m_shards.clear();
+    for (int i = 0; i < shards; i++)
+    {
+        m_shards.emplace_back(new Shard);
+    }
+    m_shardCapacity = capacity / shards;
+
+    LOG_INFO("response cache capacity:%luMB shards:%d", capacity / 1024 / 1024, shards);
+}
+
+std::string RpcResponseCache::MakeKey(uint32_t method_id, const char *args, size_t args_size)
+{
+    std::string key;
+    key.reserve(sizeof(method_id) + args_size);
+    key.append(reinterpret_cast<const char *>(&method_id), sizeof(method_id));
+    key.append(args, args_size);
+    return key;
+}
+
+RpcResponseCache::Shard &RpcResponseCache::ShardOf(const std::string &key)
+{
+    return *m_shards[std::hash<std::string>()(key) % m_shards.size()];
+}
+
+void RpcResponseCache::Erase(Shard &shard, std::list<Entry>::iterator it)
+{
+    shard.bytes -= EntryBytes(*it);
+    shard.index.erase(it->key);
+    shard.lru.erase(it);
+}
+
+bool RpcResponseCache::Lookup(const std::string &key, int64_t now_us, std::string *response)
+{
+    Shard &shard = ShardOf(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end())
+        {
+            if (it->second->expire_us > now_us)
+            {
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                *response = it->second->response;
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            Erase(shard, it->second);
+        }
+    }
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void RpcResponseCache::Insert(const std::string &key, const std::string &response, int64_t expire_us)
+{
+    if (m_shards.empty())
+    {
+        return;
+    }
+    Entry entry{key, response, expire_us};
+    size_t bytes = EntryBytes(entry);
+    if (bytes > m_shardCapacity)
+    {
+        // 单个响应超过分片容量，缓存它只会把其他条目全部挤掉
+        return;
+    }
+
+    Shard &shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end())
+    {
+        Erase(shard, it->second);
+    }
+    while (shard.bytes + bytes > m_shardCapacity && !shard.lru.empty())
+    {
+        Erase(shard, std::prev(shard.lru.end()));
+    }
+    shard.lru.push_front(std::move(entry));
+    shard.index[key] = shard.lru.begin();
+    shard.bytes += bytes;
+}
@@ -0,0 +1,611 @@
+#include "rpcclienttransport.h"
+#include "mprpcapplication.h"
+#include "mprpcshmchannel.h"
+#ifdef MPRPC_WITH_URING
+#include "rpcuring.h"
+#endif
+#include "rpctracer.h"
+
+#include <string>
+#include <cstring>
+#include <vector>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <errno.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+static void SetErrno(google::protobuf::RpcController *controller, const char *what, int err)
+{
+    char errText[512]={0};
+    sprintf(errText,"%s error!errno:%d",what,err);
+    controller->SetFailed(errText);
+}
+
+//从socket中读满len个字节，对端关闭或出错时返回false
+static bool RecvAll(int fd,char *buf,size_t len)
+{
+    size_t received=0;
+    while(received<len)
+    {
+        ssize_t n=recv(fd,buf+received,len-received,0);
+        if(n<=0)
+        {
+            if(n==-1&&errno==EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        received+=n;
+    }
+    return true;
+}
+
+//响应帧的大小上限，rpc_max_frame_bytes配置，默认64MB，和provider一侧相同。
+//provider声明的长度超过上限时按错误断开，不按对端给出的长度分配内存
+size_t RpcMaxFrameBytes()
+{
+    static const size_t max_frame_bytes=[]()
+    {
+        std::string value=MprpcApplication::GetConfig().Load("rpc_max_frame_bytes");
+        return value.empty() ? static_cast<size_t>(64*1024*1024) : static_cast<size_t>(atol(value.c_str()));
+    }();
+    return max_frame_bytes;
+}
+
+//buffer中已经有完整的响应帧时解析响应头并返回帧长度，还不完整返回0，响应头错误或者帧超过上限返回-1
+static int64_t ParseResponseFrame(const char *data, size_t size, mprpc::RpcResponseHeader *header)
+{
+    if(size<4)
+    {
+        return 0;
+    }
+    uint32_t header_size=0;
+    memcpy(&header_size,data,4);
+    header_size=ntohl(header_size);
+    if(header_size>RpcMaxFrameBytes())
+    {
+        return -1;
+    }
+    if(size<4+static_cast<size_t>(header_size))
+    {
+        return 0;
+    }
+    if(!header->ParseFromArray(data+4,header_size))
+    {
+        return -1;
+    }
+    size_t frame_size=4+static_cast<size_t>(header_size)+header->body_size();
+    if(frame_size>RpcMaxFrameBytes())
+    {
+        return -1;
+    }
+    return size<frame_size ? 0 : static_cast<int64_t>(frame_size);
+}
+
+//阻塞socket上的连接，tcp和unix域socket相同
+class TcpClientConnection : public RpcClientConnection
+{
+public:
+    explicit TcpClientConnection(int fd) : m_fd(fd) {}
+    ~TcpClientConnection() { close(m_fd); }
+
+    bool WriteFrame(const std::string &frame, google::protobuf::RpcController *controller) override
+    {
+        size_t sent=0;
+        while(sent<frame.size())
+        {
+            ssize_t n=send(m_fd,frame.data()+sent,frame.size()-sent,MSG_NOSIGNAL);
+            if(n==-1)
+            {
+                if(errno==EINTR)
+                {
+                    continue;
+                }
+                SetErrno(controller,"send",errno);
+                return false;
+            }
+            sent+=n;
+        }
+        return true;
+    }
+
+    //先读4字节的响应头长度，再读响应头，最后按body_size读响应数据
+    bool ReadFrame(mprpc::RpcResponseHeader *header, std::string *body,
+                   google::protobuf::RpcController *controller) override
+    {
+        uint32_t net_header_size=0;
+        if(!RecvAll(m_fd,reinterpret_cast<char*>(&net_header_size),4))
+        {
+            SetErrno(controller,"recv",errno);
+            return false;
+        }
+        //两个长度都来自对端，超过上限时不分配内存，直接按错误返回，连接随之关闭
+        size_t header_size=ntohl(net_header_size);
+        if(header_size>RpcMaxFrameBytes())
+        {
+            controller->SetFailed("response header too large!");
+            return false;
+        }
+        std::string header_str(header_size,'\0');
+        if(!RecvAll(m_fd,&header_str[0],header_str.size())||!header->ParseFromString(header_str))
+        {
+            controller->SetFailed("response header recv or parse error!");
+            return false;
+        }
+        if(4+header_size+header->body_size()>RpcMaxFrameBytes())
+        {
+            controller->SetFailed("response frame too large!");
+            return false;
+        }
+        body->assign(header->body_size(),'\0');
+        if(!RecvAll(m_fd,&(*body)[0],body->size()))
+        {
+            SetErrno(controller,"recv",errno);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    int m_fd;
+};
+
+std::unique_ptr<RpcClientConnection> RpcTcpClientTransport::Connect(const RpcEndpoint &endpoint,
+                                                                    google::protobuf::RpcController *controller)
+{
+    if(!endpoint.unix_path.empty()&&endpoint.unix_path.size()<sizeof(sockaddr_un::sun_path))
+    {
+        int unixfd=socket(AF_UNIX,SOCK_STREAM,0);
+        struct sockaddr_un unix_addr;
+        memset(&unix_addr,0,sizeof(unix_addr));
+        unix_addr.sun_family=AF_UNIX;
+        memcpy(unix_addr.sun_path,endpoint.unix_path.data(),endpoint.unix_path.size());
+        if(unixfd!=-1&&0==connect(unixfd,(sockaddr *)&unix_addr,sizeof(unix_addr)))
+        {
+            return std::unique_ptr<RpcClientConnection>(new TcpClientConnection(unixfd));
+        }
+        //unix socket不可用(例如provider已经退出)，退回到TCP
+        if(unixfd!=-1)
+        {
+            close(unixfd);
+        }
+    }
+
+    //使用tcp编程，完成rpc方法的远程调用
+    int clientfd=socket(AF_INET,SOCK_STREAM,0);
+    if(clientfd==-1)
+    {
+        SetErrno(controller,"create socket",errno);
+        return nullptr;
+    }
+
+    struct sockaddr_in server_addr;
+    memset(&server_addr,0,sizeof(server_addr));
+    server_addr.sin_family=AF_INET;
+    server_addr.sin_port=htons(endpoint.port);
+    server_addr.sin_addr.s_addr=inet_addr(endpoint.ip.c_str());
+
+    //连接rpc服务节点
+    if(-1==connect(clientfd,(sockaddr *)&server_addr,sizeof(server_addr)))
+    {
+        SetErrno(controller,"connect",errno);
+        close(clientfd);
+        return nullptr;
+    }
+    return std::unique_ptr<RpcClientConnection>(new TcpClientConnection(clientfd));
+}
+
+#ifdef MPRPC_WITH_URING
+//每个调用线程一个io_uring和两块注册给内核的固定缓冲区，第0块发送，第1块接收
+struct UringClient
+{
+    RpcUring ring;
+    std::vector<char> buffer;
+    bool fixed; //固定缓冲区注册成功，读写用READ_FIXED/WRITE_FIXED
+
+    char *WriteBuffer() { return buffer.data(); }
+    char *ReadBuffer() { return buffer.data()+buffer.size()/2; }
+};
+
+static const size_t kUringClientBufferSize=64*1024;
+
+enum UringCallOp
+{
+    kUringConnect=0,
+    kUringWrite=1,
+    kUringRead=2,
+    kUringOps=3,
+};
+
+//内核不支持io_uring时返回nullptr
+static UringClient *GetUringClient()
+{
+    thread_local std::unique_ptr<UringClient> client;
+    thread_local bool unavailable=false;
+    if(!client&&!unavailable)
+    {
+        std::unique_ptr<UringClient> created(new UringClient);
+        if(created->ring.Init(8))
+        {
+            created->buffer.resize(2*kUringClientBufferSize);
+            struct iovec iovs[2];
+            iovs[0].iov_base=created->WriteBuffer();
+            iovs[0].iov_len=kUringClientBufferSize;
+            iovs[1].iov_base=created->ReadBuffer();
+            iovs[1].iov_len=kUringClientBufferSize;
+            created->fixed=created->ring.RegisterBuffers(iovs,2);
+            client=std::move(created);
+        }
+        else
+        {
+            unavailable=true;
+        }
+    }
+    return client.get();
+}
+
+//一个线程同一时间只有一条连接有进行中的操作：连接的方法返回前收完自己的完成项，只有首次发送后挂着的接收例外，
+//它在ReadFrame或者析构时收回
+class UringClientConnection : public RpcClientConnection
+{
+public:
+    UringClientConnection(UringClient *client, int fd, const struct sockaddr_in &addr)
+        : m_client(client), m_fd(fd), m_addr(addr), m_connected(false), m_readPending(false)
+    {
+        for(int i=0;i<kUringOps;i++)
+        {
+            m_done[i]=true;
+            m_results[i]=0;
+        }
+    }
+
+    ~UringClientConnection()
+    {
+        if(m_readPending)
+        {
+            //让挂着的接收立即结束，收回它的完成项之后才能关闭fd
+            shutdown(m_fd,SHUT_RDWR);
+            Reap(kUringRead);
+        }
+        close(m_fd);
+    }
+
+    bool WriteFrame(const std::string &frame, google::protobuf::RpcController *controller) override
+    {
+        bool use_fixed=m_client->fixed&&frame.size()<=kUringClientBufferSize;
+        if(use_fixed)
+        {
+            memcpy(m_client->WriteBuffer(),frame.data(),frame.size());
+        }
+        if(!m_connected)
+        {
+            //连接、发送和第一次接收链接在一起，一次io_uring_enter提交，前一个操作完成后内核才开始下一个
+            struct io_uring_sqe *sqe=Prep(kUringConnect);
+            sqe->opcode=IORING_OP_CONNECT;
+            sqe->addr=reinterpret_cast<uint64_t>(&m_addr);
+            sqe->off=sizeof(m_addr);
+            sqe->flags=IOSQE_IO_LINK;
+            PrepWrite(frame,0,use_fixed)->flags=IOSQE_IO_LINK;
+            PrepRead();
+            if(!Reap(kUringConnect)||m_results[kUringConnect]<0)
+            {
+                int err=m_done[kUringConnect] ? -m_results[kUringConnect] : errno;
+                Reap(kUringWrite);
+                Reap(kUringRead);
+                m_readPending=false;
+                SetErrno(controller,"connect",err);
+                return false;
+            }
+            m_connected=true;
+        }
+        else
+        {
+            PrepWrite(frame,0,use_fixed);
+        }
+
+        size_t written=0;
+        for(;;)
+        {
+            if(!Reap(kUringWrite)||m_results[kUringWrite]<=0)
+            {
+                SetErrno(controller,"send",m_results[kUringWrite]<0 ? -m_results[kUringWrite] : EIO);
+                return false;
+            }
+            written+=m_results[kUringWrite];
+            if(written>=frame.size())
+            {
+                return true;
+            }
+            //发送不完整时链接中断，挂着的接收被取消，ReadFrame重新提交
+            PrepWrite(frame,written,use_fixed);
+        }
+    }
+
+    bool ReadFrame(mprpc::RpcResponseHeader *header, std::string *body,
+                   google::protobuf::RpcController *controller) override
+    {
+        for(;;)
+        {
+            int64_t frame_size=ParseResponseFrame(m_input.data(),m_input.size(),header);
+            if(frame_size<0)
+            {
+                controller->SetFailed("response header recv or parse error!");
+                return false;
+            }
+            if(frame_size>0)
+            {
+                body->assign(m_input.data()+frame_size-header->body_size(),header->body_size());
+                m_input.erase(0,frame_size);
+                return true;
+            }
+            if(!m_readPending)
+            {
+                PrepRead();
+            }
+            bool reaped=Reap(kUringRead);
+            m_readPending=false;
+            int received=reaped ? m_results[kUringRead] : -errno;
+            if(received>0)
+            {
+                m_input.append(m_client->ReadBuffer(),received);
+            }
+            else if(received!=-ECANCELED&&received!=-EINTR&&received!=-EAGAIN)
+            {
+                SetErrno(controller,"recv",-received);
+                return false;
+            }
+        }
+    }
+
+private:
+    struct io_uring_sqe *Prep(UringCallOp op)
+    {
+        struct io_uring_sqe *sqe=m_client->ring.GetSqe();
+        sqe->fd=m_fd;
+        sqe->user_data=op;
+        m_done[op]=false;
+        return sqe;
+    }
+
+    //请求放得下时已经拷贝到固定缓冲区中
+    struct io_uring_sqe *PrepWrite(const std::string &frame, size_t written, bool use_fixed)
+    {
+        struct io_uring_sqe *sqe=Prep(kUringWrite);
+        if(use_fixed)
+        {
+            sqe->opcode=IORING_OP_WRITE_FIXED;
+            sqe->addr=reinterpret_cast<uint64_t>(m_client->WriteBuffer()+written);
+            sqe->off=static_cast<uint64_t>(-1);
+            sqe->buf_index=0;
+        }
+        else
+        {
+            sqe->opcode=IORING_OP_SEND;
+            sqe->addr=reinterpret_cast<uint64_t>(frame.data()+written);
+            sqe->msg_flags=MSG_NOSIGNAL;
+        }
+        sqe->len=frame.size()-written;
+        return sqe;
+    }
+
+    void PrepRead()
+    {
+        struct io_uring_sqe *sqe=Prep(kUringRead);
+        sqe->opcode=m_client->fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe->addr=reinterpret_cast<uint64_t>(m_client->ReadBuffer());
+        sqe->len=kUringClientBufferSize;
+        sqe->off=static_cast<uint64_t>(-1);
+        sqe->buf_index=1;
+        m_readPending=true;
+    }
+
+    //提交所有准备好的操作，直到op完成；途中完成的其他操作的结果一并记下
+    bool Reap(UringCallOp op)
+    {
+        while(!m_done[op])
+        {
+            struct io_uring_cqe *cqe=m_client->ring.PeekCqe();
+            if(cqe==nullptr)
+            {
+                int ret=m_client->ring.Submit(1);
+                if(ret<0)
+                {
+                    errno=-ret;
+                    return false;
+                }
+                continue;
+            }
+            if(cqe->user_data<kUringOps)
+            {
+                m_results[cqe->user_data]=cqe->res;
+                m_done[cqe->user_data]=true;
+            }
+            m_client->ring.SeenCqe();
+        }
+        return true;
+    }
+
+    UringClient *m_client;
+    int m_fd;
+    struct sockaddr_in m_addr;
+    bool m_connected;
+    bool m_readPending;
+    bool m_done[kUringOps];
+    int m_results[kUringOps];
+    std::string m_input; //收到但还没有组成完整帧的数据
+};
+
+std::unique_ptr<RpcClientConnection> RpcUringClientTransport::Connect(const RpcEndpoint &endpoint,
+                                                                      google::protobuf::RpcController *controller)
+{
+    UringClient *client=GetUringClient();
+    if(client==nullptr||!endpoint.unix_path.empty())
+    {
+        static RpcTcpClientTransport tcp;
+        return tcp.Connect(endpoint,controller);
+    }
+    int clientfd=socket(AF_INET,SOCK_STREAM|SOCK_CLOEXEC,0);
+    if(clientfd==-1)
+    {
+        SetErrno(controller,"create socket",errno);
+        return nullptr;
+    }
+    struct sockaddr_in server_addr;
+    memset(&server_addr,0,sizeof(server_addr));
+    server_addr.sin_family=AF_INET;
+    server_addr.sin_port=htons(endpoint.port);
+    server_addr.sin_addr.s_addr=inet_addr(endpoint.ip.c_str());
+    //连接和请求一起在WriteFrame中提交
+    return std::unique_ptr<RpcClientConnection>(new UringClientConnection(client,clientfd,server_addr));
+}
+#endif
+
+//调用线程的共享内存会话，provider关闭会话后下一次调用重新建立
+struct ShmClientSession
+{
+    int sock;
+    std::unique_ptr<RpcShmSegment> segment;
+
+    ShmClientSession() : sock(-1) {}
+    ~ShmClientSession()
+    {
+        if(sock!=-1)
+        {
+            close(sock);
+        }
+    }
+
+    //响应队列损坏的会话同样丢弃，下一次调用重新建立
+    bool Closed() const
+    {
+        if(segment->Responses().Corrupted())
+        {
+            return true;
+        }
+        char c;
+        ssize_t n=recv(sock,&c,1,MSG_DONTWAIT|MSG_PEEK);
+        return n==0||(n==-1&&errno!=EAGAIN&&errno!=EWOULDBLOCK&&errno!=EINTR);
+    }
+};
+
+class ShmClientConnection : public RpcClientConnection
+{
+public:
+    explicit ShmClientConnection(ShmClientSession *session) : m_session(session), m_requestId(0)
+    {
+        MprpcConfig &config=MprpcApplication::GetConfig();
+        m_busyPollUs=atoi(config.Load("rpc_shm_busy_poll_us").c_str());
+        int timeout_ms=atoi(config.Load("rpc_shm_timeout_ms").c_str());
+        m_timeoutMs=timeout_ms>0 ? timeout_ms : 5000;
+    }
+
+    bool WriteFrame(const std::string &frame, google::protobuf::RpcController *controller) override
+    {
+        //记下请求id，之前超时的调用的响应可能还留在队列里，接收时按id跳过
+        uint32_t header_size=0;
+        mprpc::RpcHeader rpcHeader;
+        if(frame.size()>=4)
+        {
+            memcpy(&header_size,frame.data(),4);
+            header_size=ntohl(header_size);
+        }
+        if(frame.size()<4||header_size>frame.size()-4||!rpcHeader.ParseFromArray(frame.data()+4,header_size))
+        {
+            controller->SetFailed("rpc header parse error!");
+            return false;
+        }
+        m_requestId=rpcHeader.request_id();
+
+        RpcShmRing &requests=m_session->segment->Requests();
+        char *out=requests.Reserve(frame.size(),m_timeoutMs);
+        if(out==nullptr)
+        {
+            controller->SetFailed("shm request ring is full or request too large!");
+            return false;
+        }
+        memcpy(out,frame.data(),frame.size());
+        requests.Commit(frame.size());
+        return true;
+    }
+
+    bool ReadFrame(mprpc::RpcResponseHeader *header, std::string *body,
+                   google::protobuf::RpcController *controller) override
+    {
+        RpcShmRing &responses=m_session->segment->Responses();
+        int64_t deadline_us=RpcTracer::NowMicros()+static_cast<int64_t>(m_timeoutMs)*1000;
+        for(;;)
+        {
+            if(!responses.Wait(m_busyPollUs,100))
+            {
+                if(m_session->Closed())
+                {
+                    controller->SetFailed("shm session closed by provider!");
+                    return false;
+                }
+                if(RpcTracer::NowMicros()>=deadline_us)
+                {
+                    controller->SetFailed("shm call timeout!");
+                    return false;
+                }
+                continue;
+            }
+            uint32_t frame_len=0;
+            const char *data=responses.Peek(&frame_len);
+            if(data==nullptr)
+            {
+                if(responses.Corrupted())
+                {
+                    controller->SetFailed("shm responce ring corrupted!");
+                    return false;
+                }
+                continue;
+            }
+            int64_t frame_size=ParseResponseFrame(data,frame_len,header);
+            if(frame_size!=static_cast<int64_t>(frame_len))
+            {
+                responses.Consume(frame_len);
+                controller->SetFailed("shm responce header parse error!");
+                return false;
+            }
+            if(header->request_id()!=m_requestId)
+            {
+                responses.Consume(frame_len);
+                continue;
+            }
+            body->assign(data+frame_len-header->body_size(),header->body_size());
+            responses.Consume(frame_len);
+            return true;
+        }
+    }
+
+private:
+    ShmClientSession *m_session;
+    uint64_t m_requestId;
+    int64_t m_busyPollUs;
+    int m_timeoutMs;
+};
+
+std::unique_ptr<RpcClientConnection> RpcShmClientTransport::Connect(const RpcEndpoint &,
+                                                                    google::protobuf::RpcController *controller)
+{
+    thread_local std::unique_ptr<ShmClientSession> session;
+    if(session&&session->Closed())
+    {
+        session.reset();
+    }
+    if(!session)
+    {
+        std::unique_ptr<ShmClientSession> created(new ShmClientSession);
+        if(!MprpcShmChannel::OpenSession(MprpcApplication::GetConfig().Load("rpc_shm_path"),&created->sock,&created->segment))
+        {
+            controller->SetFailed("shm session setup error!");
+            return nullptr;
+        }
+        session=std::move(created);
+    }
+    return std::unique_ptr<RpcClientConnection>(new ShmClientConnection(session.get()));
+}
@@ -0,0 +1,420 @@
+#include "rpccompress.h"
+#include "mprpcapplication.h"
+#include "zookeeperutil.h"
+#include "logger.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <unordered_map>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <lz4.h>
+#include <zstd.h>
+#include <zdict.h>
+
+// 解压后的大小上限，防止损坏或者恶意的raw_size让接收方分配过大的内存
+static const uint32_t kMaxRawSize = 64 * 1024 * 1024;
+// lz4的最大压缩比，一个字节的匹配长度扩展最多表示255个字节
+static const uint64_t kLz4MaxRatio = 255;
+// zstd一个块解压后的最大大小和压缩后的最小大小
+static const uint64_t kZstdMaxBlockBytes = 128 * 1024;
+static const uint64_t kZstdMinBlockBytes = 4;
+// 线程复用的解压缓冲区超过这个大小时用完就释放
+static const size_t kKeepBufferBytes = 4 * 1024 * 1024;
+// 配置了字典的方法默认的压缩阈值
+static const uint32_t kDictMinBytes = 32;
+
+// 每个线程的压缩和解压上下文，线程退出时释放
+struct CompressContext
+{
+    ZSTD_CCtx *zstd_c;
+    ZSTD_DCtx *zstd_d;
+    std::string lz4_state;
+    // 字典id到字典的缓存，避免每次解压都查全局表
+    std::unordered_map<uint32_t, const RpcDictionary *> dicts;
+
+    CompressContext() : zstd_c(ZSTD_createCCtx()), zstd_d(ZSTD_createDCtx()), lz4_state(LZ4_sizeofState(), '\0') {}
+    ~CompressContext()
+    {
+        ZSTD_freeCCtx(zstd_c);
+        ZSTD_freeDCtx(zstd_d);
+    }
+};
+
+static CompressContext &ThreadContext()
+{
+    thread_local CompressContext context;
+    return context;
+}
+
+static int ZstdLevel()
+{
+    static const int level = [] {
+        std::string value = MprpcApplication::GetConfig().Load("rpc_compress_zstd_level");
+        return value.empty() ? 1 : atoi(value.c_str());
+    }();
+    return level;
+}
+
+// 预先处理过的字典，只读，所有线程共享
+struct RpcDictionary
+{
+    uint32_t id;
+    ZSTD_CDict *cdict;
+    ZSTD_DDict *ddict;
+};
+
+static std::mutex g_dictMutex;
+static std::unordered_map<uint32_t, std::unique_ptr<RpcDictionary>> g_dicts;
+
+static const RpcDictionary *FindDictionary(uint32_t id)
+{
+    CompressContext &context = ThreadContext();
+    auto it = context.dicts.find(id);
+    if (it != context.dicts.end())
+    {
+        return it->second;
+    }
+    std::lock_guard<std::mutex> lock(g_dictMutex);
+    auto git = g_dicts.find(id);
+    if (git == g_dicts.end())
+    {
+        return nullptr;
+    }
+    context.dicts[id] = git->second.get();
+    return git->second.get();
+}
+
+uint32_t RpcCompressor::AddDictionary(const std::string &content)
+{
+    uint32_t id = ZDICT_getDictID(content.data(), content.size());
+    if (id == 0)
+    {
+        LOG_ERR("invalid zstd dictionary, size:%zu", content.size());
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(g_dictMutex);
+    std::unique_ptr<RpcDictionary> &slot = g_dicts[id];
+    if (!slot)
+    {
+        slot.reset(new RpcDictionary);
+        slot->id = id;
+        slot->cdict = ZSTD_createCDict(content.data(), content.size(), ZstdLevel());
+        slot->ddict = ZSTD_createDDict(content.data(), content.size());
+        LOG_INFO("zstd dictionary %u loaded, size:%zu", id, content.size());
+    }
+    return id;
+}
+
+// zookeeper上的字典：<rpc_dict_zk_path>/<服务>.<方法>/dict0000000001...，序号最大的是最新版本
+static std::mutex g_zkMutex;
+static std::unique_ptr<ZkClient> g_zkClient;
+static std::unordered_map<std::string, std::unordered_map<std::string, uint32_t>> g_zkLoaded; // 每个方法已加载的节点和字典id
+
+static ZkClient *DictZkClient()
+{
+    if (!g_zkClient)
+    {
+        MprpcConfig &config = MprpcApplication::GetConfig();
+        g_zkClient.reset(new ZkClient(config.Load("zookeeperip") + ":" + config.Load("zookeeperport")));
+        g_zkClient->Start();
+    }
+    return g_zkClient->IsConnected() ? g_zkClient.get() : nullptr;
+}
+
+// 加载方法节点下还没有加载过的字典，返回序号最大的字典的id，调用方持有g_zkMutex
+static uint32_t LoadZkDictionaries(ZkClient *zk, const std::string &path)
+{
+    std::vector<std::string> children = zk->GetChildren(path.c_str());
+    std::sort(children.begin(), children.end());
+    std::unordered_map<std::string, uint32_t> &loaded = g_zkLoaded[path];
+    uint32_t newest = 0;
+    for (const std::string &child : children)
+    {
+        auto it = loaded.find(child);
+        if (it == loaded.end())
+        {
+            it = loaded.emplace(child, RpcCompressor::AddDictionary(zk->GetData((path + "/" + child).c_str()))).first;
+        }
+        newest = it->second != 0 ? it->second : newest;
+    }
+    return newest;
+}
+
+static uint32_t WatchZkDictionaries(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(g_zkMutex);
+    ZkClient *zk = DictZkClient();
+    if (zk == nullptr || !zk->Exists(path.c_str()))
+    {
+        return 0;
+    }
+    uint32_t newest = LoadZkDictionaries(zk, path);
+    // 监听回调在zookeeper的回调线程中执行，同步读取节点会等待这个线程自己，所以交给新线程加载
+    zk->WatchChildren(path.c_str(), [path](int rc, const std::vector<std::string> &) {
+        std::thread([path] {
+            std::lock_guard<std::mutex> lock(g_zkMutex);
+            LoadZkDictionaries(g_zkClient.get(), path);
+        }).detach();
+    });
+    return newest;
+}
+
+// 方法的字典只加载一次，PolicyFor在每个线程中各自调用LoadPolicy
+static const RpcDictionary *MethodDictionary(const std::string &key)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, const RpcDictionary *> dicts;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = dicts.find(key);
+    if (it != dicts.end())
+    {
+        return it->second;
+    }
+
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    uint32_t id = 0;
+    std::string file = config.Load(key + ".compress_dict");
+    std::string zk_path = config.Load("rpc_dict_zk_path");
+    if (!file.empty())
+    {
+        std::ifstream in(file, std::ios::binary);
+        if (!in)
+        {
+            LOG_ERR("open dictionary %s error", file.c_str());
+        }
+        id = RpcCompressor::AddDictionary(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()));
+    }
+    else if (!zk_path.empty())
+    {
+        id = WatchZkDictionaries(zk_path + "/" + key);
+    }
+    const RpcDictionary *dict = id != 0 ? FindDictionary(id) : nullptr;
+    dicts[key] = dict;
+    return dict;
+}
+
+static mprpc::RpcCompression ParseCodec(const std::string &name)
+{
+    if (name == "lz4")
+    {
+        return mprpc::COMPRESS_LZ4;
+    }
+    if (name == "zstd")
+    {
+        return mprpc::COMPRESS_ZSTD;
+    }
+    if (!name.empty() && name != "none")
+    {
+        LOG_ERR("unknown compression %s, compression disabled", name.c_str());
+    }
+    return mprpc::COMPRESS_NONE;
+}
+
+RpcCompressPolicy RpcCompressor::LoadPolicy(const std::string &service_name, const std::string &method_name)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    std::string key = service_name + "." + method_name;
+    std::string codec = config.Load(key + ".compress");
+    std::string min_bytes = config.Load(key + ".compress_min_bytes");
+
+    RpcCompressPolicy policy;
+    policy.codec = ParseCodec(codec.empty() ? config.Load("rpc_compress") : codec);
+    policy.dict = MethodDictionary(key);
+    if (policy.dict != nullptr)
+    {
+        policy.codec = mprpc::COMPRESS_ZSTD;
+        policy.dict_id = policy.dict->id;
+        if (min_bytes.empty())
+        {
+            min_bytes = std::to_string(kDictMinBytes);
+        }
+    }
+    if (min_bytes.empty())
+    {
+        min_bytes = config.Load("rpc_compress_min_bytes");
+    }
+    policy.min_bytes = min_bytes.empty() ? 1024 : atoi(min_bytes.c_str());
+    return policy;
+}
+
+const RpcCompressPolicy &RpcCompressor::PolicyFor(const google::protobuf::MethodDescriptor *method)
+{
+    thread_local std::unordered_map<const google::protobuf::MethodDescriptor *, RpcCompressPolicy> policies;
+    auto it = policies.find(method);
+    if (it == policies.end())
+    {
+        it = policies.emplace(method, LoadPolicy(method->service()->name(), method->name())).first;
+    }
+    return it->second;
+}
+
+bool RpcCompressor::Compress(const RpcCompressPolicy &policy, const char *data, size_t size, std::string *out)
+{
+    if (policy.codec == mprpc::COMPRESS_NONE || size < policy.min_bytes || size == 0 || size > kMaxRawSize)
+    {
+        return false;
+    }
+
+    CompressContext &context = ThreadContext();
+    size_t compressed = 0;
+    if (policy.codec == mprpc::COMPRESS_LZ4)
+    {
+        out->resize(LZ4_compressBound(size));
+        compressed = LZ4_compress_fast_extState(&context.lz4_state[0], data, &(*out)[0], size, out->size(), 1);
+    }
+    else if (policy.codec == mprpc::COMPRESS_ZSTD)
+    {
+        out->resize(ZSTD_compressBound(size));
+        if (policy.dict != nullptr)
+        {
+            // 字典id已经在消息头里，zstd帧头不再重复写一遍，小消息能省下几个字节
+            ZSTD_CCtx_reset(context.zstd_c, ZSTD_reset_session_and_parameters);
+            ZSTD_CCtx_refCDict(context.zstd_c, policy.dict->cdict);
+            ZSTD_CCtx_setParameter(context.zstd_c, ZSTD_c_dictIDFlag, 0);
+            compressed = ZSTD_compress2(context.zstd_c, &(*out)[0], out->size(), data, size);
+        }
+        else
+        {
+            compressed = ZSTD_compressCCtx(context.zstd_c, &(*out)[0], out->size(), data, size, ZstdLevel());
+        }
+        if (ZSTD_isError(compressed))
+        {
+            compressed = 0;
+        }
+    }
+    // 压缩后没有变小就不压缩，接收方省去一次解压
+    if (compressed == 0 || compressed >= size)
+    {
+        return false;
+    }
+    out->resize(compressed);
+    return true;
+}
+
+bool RpcCompressor::Decompress(mprpc::RpcCompression codec, uint32_t dict_id, const char *data, size_t size,
+                               uint32_t raw_size, std::string *out)
+{
+    if (raw_size > kMaxRawSize)
+    {
+        return false;
+    }
+    // 分配之前先用压缩数据本身核对raw_size，伪造的raw_size不能让一个很小的请求分配大块内存
+    if (codec == mprpc::COMPRESS_LZ4)
+    {
+        // lz4的压缩比不超过255
+        if (raw_size > static_cast<uint64_t>(size) * kLz4MaxRatio)
+        {
+            return false;
+        }
+    }
+    else if (codec == mprpc::COMPRESS_ZSTD)
+    {
+        // 压缩时总是把原始大小写进帧头，和消息头不一致或者没有写的帧都不解压。
+        // 帧头的大小同样是发送方填的，再按块的结构限制：每个块至少4个字节(3字节块头加1字节RLE)，最多解出128KB
+        unsigned long long content_size = ZSTD_getFrameContentSize(data, size);
+        if (content_size != raw_size || raw_size > (static_cast<uint64_t>(size) / kZstdMinBlockBytes + 1) * kZstdMaxBlockBytes)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+    out->resize(raw_size);
+
+    CompressContext &context = ThreadContext();
+    if (codec == mprpc::COMPRESS_LZ4)
+    {
+        int n = LZ4_decompress_safe(data, &(*out)[0], size, raw_size);
+        return n >= 0 && static_cast<uint32_t>(n) == raw_size;
+    }
+    if (codec == mprpc::COMPRESS_ZSTD)
+    {
+        size_t n;
+        if (dict_id != 0)
+        {
+            const RpcDictionary *dict = FindDictionary(dict_id);
+            if (dict == nullptr)
+            {
+                LOG_ERR("unknown zstd dictionary %u", dict_id);
+                return false;
+            }
+            n = ZSTD_decompress_usingDDict(context.zstd_d, &(*out)[0], raw_size, data, size, dict->ddict);
+        }
+        else
+        {
+            n = ZSTD_decompressDCtx(context.zstd_d, &(*out)[0], raw_size, data, size);
+        }
+        return !ZSTD_isError(n) && n == raw_size;
+    }
+    return false;
+}
+
+bool RpcCompressor::HasDictionary(uint32_t dict_id)
+{
+    return FindDictionary(dict_id) != nullptr;
+}
+
+void RpcCompressor::ReleaseBuffer(std::string *buffer)
+{
+    if (buffer->capacity() > kKeepBufferBytes)
+    {
+        std::string().swap(*buffer);
+    }
+}
+
+bool RpcCompressor::Capturing()
+{
+    static const bool capturing = !MprpcApplication::GetConfig().Load("rpc_dict_capture_dir").empty();
+    return capturing;
+}
+
+void RpcCompressor::Capture(const std::string &service_name, const std::string &method_name, const std::string &data)
+{
+    struct CaptureFile
+    {
+        int fd;
+        int count;
+    };
+    static std::mutex mutex;
+    static std::unordered_map<std::string, CaptureFile> files;
+    static const int max_samples = [] {
+        std::string value = MprpcApplication::GetConfig().Load("rpc_dict_capture_max");
+        return value.empty() ? 10000 : atoi(value.c_str());
+    }();
+
+    std::string key = service_name + "." + method_name;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(key);
+    if (it == files.end())
+    {
+        std::string path = MprpcApplication::GetConfig().Load("rpc_dict_capture_dir") + "/" + key + ".samples";
+        int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd < 0)
+        {
+            LOG_ERR("open capture file %s error", path.c_str());
+        }
+        it = files.emplace(key, CaptureFile{fd, 0}).first;
+    }
+    if (it->second.fd < 0 || it->second.count >= max_samples)
+    {
+        return;
+    }
+    // 每条样本为4字节网络序长度 + 数据，一次write写入，多个进程可以追加到同一个文件
+    std::string record(4, '\0');
+    uint32_t net_size = htonl(data.size());
+    memcpy(&record[0], &net_size, 4);
+    record += data;
+    if (write(it->second.fd, record.data(), record.size()) == static_cast<ssize_t>(record.size()))
+    {
+        it->second.count++;
+    }
+}
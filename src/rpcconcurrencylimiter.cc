@@ -0,0 +1,189 @@
+#include "rpcconcurrencylimiter.h"
+#include "rpcheader.pb.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+// RTT超过最小RTT的这个倍数才开始收缩，容忍正常的抖动
+static const double kRttTolerance = 1.5;
+// 两次探测之间至少间隔的样本数，上限较大时按30倍上限计
+static const int kProbeInterval = 1000;
+// 探测期间超出探测上限的调用最多等待的最小RTT倍数和时间
+static const int64_t kProbeWaitRtts = 4;
+static const int64_t kMaxProbeWaitUs = 100 * 1000;
+// 新上限和旧上限的平滑系数
+static const double kSmoothing = 0.2;
+// provider拒绝或网络错误时的收缩系数
+static const double kBackoff = 0.9;
+
+// 持续排队时观测到的RTT都带着排队时间，最小RTT会被高估，上限也就不再收缩。
+// 所以每隔一段时间探测一次：把并发压到上限的四分之一，等处理中的调用降下来之后，
+// 用接下来两轮调用的最小RTT重新作为基准，这样provider基准延迟变高或变低都能跟上
+struct RpcConcurrencyLimiter::Target
+{
+    std::mutex mutex;
+    std::condition_variable cond;
+    double limit;
+    int inflight = 0;
+    int64_t minRtt = 0;      // 最小RTT，代表provider没有排队时的响应时间
+    int samples = 0;         // 上次探测之后的样本数
+    int probeLimit = 0;      // 探测期间的并发上限，0表示没有在探测
+    bool probeDrained = false;
+    int probeSamples = 0;
+    int64_t probeMin = 0;
+};
+
+RpcConcurrencyLimiter &RpcConcurrencyLimiter::GetInstance()
+{
+    static RpcConcurrencyLimiter limiter;
+    return limiter;
+}
+
+RpcConcurrencyLimiter::RpcConcurrencyLimiter()
+    : m_enabled(false), m_initialLimit(20), m_minLimit(1), m_maxLimit(1000), m_queueMs(0)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    m_enabled = config.Load("rpc_client_limit") == "gradient";
+    if (!m_enabled)
+    {
+        return;
+    }
+    std::string value = config.Load("rpc_limit_min");
+    if (!value.empty())
+    {
+        m_minLimit = std::max(1, atoi(value.c_str()));
+    }
+    value = config.Load("rpc_limit_max");
+    if (!value.empty())
+    {
+        m_maxLimit = std::max(m_minLimit, static_cast<double>(atoi(value.c_str())));
+    }
+    value = config.Load("rpc_limit_initial");
+    if (!value.empty())
+    {
+        m_initialLimit = atoi(value.c_str());
+    }
+    m_initialLimit = std::min(std::max(m_initialLimit, m_minLimit), m_maxLimit);
+    m_queueMs = atoi(config.Load("rpc_limit_queue_ms").c_str());
+
+    LOG_INFO("client concurrency limit initial:%.0f min:%.0f max:%.0f queue:%dms",
+             m_initialLimit, m_minLimit, m_maxLimit, m_queueMs);
+}
+
+RpcConcurrencyLimiter::Target *RpcConcurrencyLimiter::Acquire(const std::string &key)
+{
+    Target *target = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_ptr<Target> &slot = m_targets[key];
+        if (!slot)
+        {
+            slot.reset(new Target);
+            slot->limit = m_initialLimit;
+        }
+        target = slot.get();
+    }
+
+    std::unique_lock<std::mutex> lock(target->mutex);
+    auto available = [target] {
+        return target->inflight < (target->probeLimit > 0 ? target->probeLimit : static_cast<int>(target->limit));
+    };
+    if (!available())
+    {
+        int64_t wait_us = static_cast<int64_t>(m_queueMs) * 1000;
+        if (target->probeLimit > 0)
+        {
+            wait_us = std::max(wait_us, std::min(kProbeWaitRtts * target->minRtt, kMaxProbeWaitUs));
+        }
+        if (wait_us <= 0 || !target->cond.wait_for(lock, std::chrono::microseconds(wait_us), available))
+        {
+            // 探测只是暂时压低并发，没有超出正常上限的调用照常放行
+            if (target->inflight >= static_cast<int>(target->limit))
+            {
+                m_rejected.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+    }
+    target->inflight++;
+    return target;
+}
+
+void RpcConcurrencyLimiter::Release(Target *target, int64_t rtt_us, int status)
+{
+    std::lock_guard<std::mutex> lock(target->mutex);
+    int inflight = target->inflight--;
+    double limit = target->limit;
+    if (target->probeLimit > 0 && !target->probeDrained && target->inflight < target->probeLimit)
+    {
+        target->probeDrained = true;
+        target->probeSamples = 0;
+        target->probeMin = 0;
+    }
+
+    if (status == mprpc::RPC_OVERLOADED || status == mprpc::RPC_UNAVAILABLE || status < 0)
+    {
+        limit = limit * kBackoff;
+    }
+    else if (rtt_us > 0 && target->probeLimit > 0)
+    {
+        // 探测期间不调整上限，只记录并发降下来之后的最小RTT
+        if (target->probeDrained)
+        {
+            if (target->probeMin == 0 || rtt_us < target->probeMin)
+            {
+                target->probeMin = rtt_us;
+            }
+            if (++target->probeSamples >= 2 * target->probeLimit)
+            {
+                target->minRtt = target->probeMin;
+                target->probeLimit = 0;
+                target->samples = 0;
+                target->cond.notify_all();
+            }
+        }
+    }
+    else if (rtt_us > 0)
+    {
+        if (target->minRtt == 0 || rtt_us < target->minRtt)
+        {
+            target->minRtt = rtt_us;
+        }
+
+        double gradient = std::max(0.5, std::min(1.0, kRttTolerance * target->minRtt / rtt_us));
+        double new_limit = limit * gradient + std::sqrt(limit);
+        // 调用方自身的并发不到上限的一半时，RTT说明不了provider还能承受多少，只收缩不增长
+        if (new_limit < limit || inflight >= limit / 2)
+        {
+            limit = limit * (1 - kSmoothing) + new_limit * kSmoothing;
+        }
+
+        if (++target->samples >= std::max(kProbeInterval, static_cast<int>(30 * limit)))
+        {
+            target->probeLimit = static_cast<int>(std::max(m_minLimit, limit / 4));
+            target->probeDrained = false;
+        }
+    }
+
+    target->limit = std::min(std::max(limit, m_minLimit), m_maxLimit);
+    target->cond.notify_one();
+}
+
+int RpcConcurrencyLimiter::Limit(const std::string &key)
+{
+    Target *target = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_targets.find(key);
+        if (it == m_targets.end())
+        {
+            return static_cast<int>(m_initialLimit);
+        }
+        target = it->second.get();
+    }
+    std::lock_guard<std::mutex> lock(target->mutex);
+    return static_cast<int>(target->limit);
+}
@@ -0,0 +1,108 @@
+#include "rpcepoch.h"
+#include <mutex>
+#include <thread>
+
+// 槽位数，超过的线程退回到加锁的读区间
+static const int kMaxSlots = 1024;
+
+struct alignas(64) EpochSlot
+{
+    std::atomic<uint64_t> epoch{0}; // 读区间开始时的纪元，0表示不在读区间中
+    std::atomic<bool> used{false};
+};
+
+static EpochSlot g_slots[kMaxSlots];
+static std::atomic<int> g_slotLimit{0}; // 分配过的槽位的上界，写者只检查这个范围
+static std::atomic<uint64_t> g_epoch{1};
+static std::mutex g_fallbackMutex;
+
+// 线程的槽位，第一次进入读区间时分配，线程退出时归还
+struct ThreadSlot
+{
+    EpochSlot *slot;
+    int depth;
+
+    ThreadSlot() : slot(nullptr), depth(0)
+    {
+        for (int i = 0; i < kMaxSlots; i++)
+        {
+            bool expected = false;
+            if (!g_slots[i].used.load(std::memory_order_relaxed) && g_slots[i].used.compare_exchange_strong(expected, true))
+            {
+                slot = &g_slots[i];
+                int limit = g_slotLimit.load();
+                while (limit < i + 1 && !g_slotLimit.compare_exchange_weak(limit, i + 1))
+                {
+                }
+                break;
+            }
+        }
+    }
+
+    ~ThreadSlot()
+    {
+        if (slot != nullptr)
+        {
+            slot->epoch.store(0);
+            slot->used.store(false, std::memory_order_release);
+        }
+    }
+};
+
+static thread_local ThreadSlot t_slot;
+
+RpcEpoch::ReadGuard::ReadGuard() : m_locked(false)
+{
+    ThreadSlot &self = t_slot;
+    if (self.depth++ > 0)
+    {
+        return;
+    }
+    if (self.slot != nullptr)
+    {
+        // 登记和之后读共享指针都是顺序一致的：写者检查槽位时要么看到这次登记，要么这里读到的已经是新指针
+        self.slot->epoch.store(g_epoch.load(std::memory_order_relaxed));
+    }
+    else
+    {
+        g_fallbackMutex.lock();
+        m_locked = true;
+    }
+}
+
+RpcEpoch::ReadGuard::~ReadGuard()
+{
+    ThreadSlot &self = t_slot;
+    if (--self.depth > 0)
+    {
+        return;
+    }
+    if (m_locked)
+    {
+        g_fallbackMutex.unlock();
+    }
+    else
+    {
+        self.slot->epoch.store(0, std::memory_order_release);
+    }
+}
+
+void RpcEpoch::Synchronize()
+{
+    // 进入新纪元，之后只需要等在旧纪元登记的读者
+    uint64_t target = g_epoch.fetch_add(1) + 1;
+    int limit = g_slotLimit.load();
+    for (int i = 0; i < limit; i++)
+    {
+        for (;;)
+        {
+            uint64_t epoch = g_slots[i].epoch.load();
+            if (epoch == 0 || epoch >= target)
+            {
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+    std::lock_guard<std::mutex> lock(g_fallbackMutex);
+}
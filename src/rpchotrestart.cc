@@ -0,0 +1,202 @@
+#include "rpchotrestart.h"
+#include "logger.h"
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+static bool MakeAddress(const std::string &path, struct sockaddr_un *addr)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr->sun_path))
+    {
+        LOG_ERR("hot restart path too long: %s", path.c_str());
+        return false;
+    }
+    memcpy(addr->sun_path, path.data(), path.size());
+    return true;
+}
+
+int RpcHotRestart::Listen(const std::string &path)
+{
+    struct sockaddr_un addr;
+    if (!MakeAddress(path, &addr))
+    {
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+    {
+        LOG_ERR("create hot restart socket error! errno:%d", errno);
+        return -1;
+    }
+    // 旧进程已经连上之后路径就不再需要，新进程直接替换它，下一次重启连的就是新进程
+    unlink(path.c_str());
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == -1 || listen(fd, 4) == -1)
+    {
+        LOG_ERR("listen on hot restart path %s error! errno:%d", path.c_str(), errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int RpcHotRestart::Connect(const std::string &path)
+{
+    struct sockaddr_un addr;
+    if (!MakeAddress(path, &addr))
+    {
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+    {
+        return -1;
+    }
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == -1)
+    {
+        // 没有旧进程在运行，正常冷启动
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool WriteAll(int sock, const char *data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = send(sock, data, len, MSG_NOSIGNAL);
+        if (n == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool ReadAll(int sock, char *data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t n = recv(sock, data, len, 0);
+        if (n <= 0)
+        {
+            if (n == -1 && errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+bool RpcHotRestart::Send(int sock, MessageType type, const std::string &data, int fd)
+{
+    char head[5];
+    head[0] = type;
+    uint32_t net_len = htonl(data.size());
+    memcpy(head + 1, &net_len, 4);
+
+    // 附带的socket放在消息头上，接收方读消息头时一起取出
+    struct iovec iov;
+    iov.iov_base = head;
+    iov.iov_len = sizeof(head);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    char control[CMSG_SPACE(sizeof(int))];
+    if (fd != -1)
+    {
+        memset(control, 0, sizeof(control));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+    }
+
+    ssize_t n;
+    do
+    {
+        n = sendmsg(sock, &msg, MSG_NOSIGNAL);
+    } while (n == -1 && errno == EINTR);
+    if (n == -1)
+    {
+        LOG_ERR("hot restart send error! errno:%d", errno);
+        return false;
+    }
+    // 附带的socket随第一个字节送出，剩余部分按普通数据发送
+    return WriteAll(sock, head + n, sizeof(head) - n) && WriteAll(sock, data.data(), data.size());
+}
+
+bool RpcHotRestart::Recv(int sock, MessageType *type, std::string *data, int *fd)
+{
+    char head[5];
+    struct iovec iov;
+    iov.iov_base = head;
+    iov.iov_len = sizeof(head);
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    char control[CMSG_SPACE(sizeof(int))];
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t n;
+    do
+    {
+        n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+    } while (n == -1 && errno == EINTR);
+    if (n <= 0)
+    {
+        return false;
+    }
+
+    *fd = -1;
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS)
+        {
+            memcpy(fd, CMSG_DATA(cmsg), sizeof(int));
+        }
+    }
+    if (!ReadAll(sock, head + n, sizeof(head) - n))
+    {
+        if (*fd != -1)
+        {
+            close(*fd);
+        }
+        return false;
+    }
+
+    *type = static_cast<MessageType>(head[0]);
+    uint32_t net_len = 0;
+    memcpy(&net_len, head + 1, 4);
+    data->resize(ntohl(net_len));
+    if (!ReadAll(sock, &(*data)[0], data->size()))
+    {
+        if (*fd != -1)
+        {
+            close(*fd);
+        }
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,181 @@
+#include "rpclistener.h"
+#include "logger.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static muduo::net::InetAddress SockAddress(int fd, bool peer)
+{
+    struct sockaddr_in6 addr;
+    memset(&addr, 0, sizeof(addr));
+    socklen_t len = sizeof(addr);
+    if (peer)
+    {
+        getpeername(fd, reinterpret_cast<struct sockaddr *>(&addr), &len);
+    }
+    else
+    {
+        getsockname(fd, reinterpret_cast<struct sockaddr *>(&addr), &len);
+    }
+    if (addr.sin6_family != AF_INET && addr.sin6_family != AF_INET6)
+    {
+        // unix域socket没有IP地址
+        return muduo::net::InetAddress();
+    }
+    return muduo::net::InetAddress(addr);
+}
+
+RpcListener::RpcListener(muduo::net::EventLoop *loop, int listen_fd, muduo::net::EventLoopThreadPool *pool)
+    : m_loop(loop),
+      m_pool(pool),
+      m_listenFd(listen_fd),
+      m_channel(loop, listen_fd),
+      m_nextConnId(1)
+{
+    m_channel.setReadCallback(std::bind(&RpcListener::HandleRead, this));
+}
+
+RpcListener::~RpcListener()
+{
+    m_channel.disableAll();
+    m_channel.remove();
+    close(m_listenFd);
+    // 和TcpServer一样，连接在各自的io线程中销毁
+    for (auto &item : m_connections)
+    {
+        muduo::net::TcpConnectionPtr conn = item.second.conn;
+        item.second.conn.reset();
+        conn->getLoop()->runInLoop(std::bind(&muduo::net::TcpConnection::connectDestroyed, conn));
+    }
+}
+
+int RpcListener::Listen(const muduo::net::InetAddress &address)
+{
+    int fd = socket(address.family(), SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+    {
+        LOG_ERR("create listen socket error! errno:%d", errno);
+        return -1;
+    }
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    socklen_t len = address.family() == AF_INET6 ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+    if (bind(fd, address.getSockAddr(), len) == -1 || listen(fd, SOMAXCONN) == -1)
+    {
+        LOG_ERR("listen on %s error! errno:%d", address.toIpPort().c_str(), errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int RpcListener::ListenUnix(const std::string &path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        LOG_ERR("unix socket path too long: %s", path.c_str());
+        return -1;
+    }
+    memcpy(addr.sun_path, path.data(), path.size());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+    {
+        LOG_ERR("create unix socket error! errno:%d", errno);
+        return -1;
+    }
+    unlink(path.c_str());
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == -1 || listen(fd, SOMAXCONN) == -1)
+    {
+        LOG_ERR("listen on %s error! errno:%d", path.c_str(), errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void RpcListener::Start()
+{
+    m_channel.enableReading();
+}
+
+void RpcListener::StopAccepting()
+{
+    m_channel.disableAll();
+}
+
+void RpcListener::HandleRead()
+{
+    for (;;)
+    {
+        int fd = accept4(m_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNABORTED)
+            {
+                LOG_ERR("accept error! errno:%d", errno);
+            }
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            return;
+        }
+        NewConnection(fd, "");
+    }
+}
+
+void RpcListener::Adopt(int fd, const std::string &initial)
+{
+    NewConnection(fd, initial);
+}
+
+void RpcListener::NewConnection(int fd, const std::string &initial)
+{
+    muduo::net::EventLoop *io_loop = m_pool != nullptr ? m_pool->getNextLoop() : m_loop;
+    char name[64];
+    snprintf(name, sizeof(name), "RpcListener-%d#%d", m_listenFd, m_nextConnId++);
+
+    muduo::net::TcpConnectionPtr conn(new muduo::net::TcpConnection(io_loop, name, fd, SockAddress(fd, false), SockAddress(fd, true)));
+    m_connections[name] = Connection{conn, fd};
+    conn->setConnectionCallback(m_connectionCallback);
+    conn->setMessageCallback(m_messageCallback);
+    conn->setCloseCallback(std::bind(&RpcListener::RemoveConnection, this, std::placeholders::_1));
+
+    muduo::net::MessageCallback message_callback = m_messageCallback;
+    io_loop->runInLoop([conn, initial, message_callback]()
+    {
+        conn->connectEstablished();
+        if (!initial.empty())
+        {
+            // 接管的连接上旧进程没处理完的请求，按刚读到的数据处理
+            conn->inputBuffer()->append(initial.data(), initial.size());
+            message_callback(conn, conn->inputBuffer(), muduo::Timestamp::now());
+        }
+    });
+}
+
+void RpcListener::RemoveConnection(const muduo::net::TcpConnectionPtr &conn)
+{
+    m_loop->runInLoop([this, conn]()
+    {
+        m_connections.erase(conn->name());
+        conn->getLoop()->queueInLoop(std::bind(&muduo::net::TcpConnection::connectDestroyed, conn));
+    });
+}
+
+std::vector<std::pair<muduo::net::TcpConnectionPtr, int>> RpcListener::Connections() const
+{
+    std::vector<std::pair<muduo::net::TcpConnectionPtr, int>> connections;
+    for (const auto &item : m_connections)
+    {
+        connections.emplace_back(item.second.conn, item.second.fd);
+    }
+    return connections;
+}
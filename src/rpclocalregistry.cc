@@ -0,0 +1,80 @@
+#include "rpclocalregistry.h"
+#include "mprpcapplication.h"
+#include <muduo/base/CountDownLatch.h>
+#include <google/protobuf/arena.h>
+
+RpcLocalRegistry &RpcLocalRegistry::GetInstance()
+{
+    static RpcLocalRegistry registry;
+    return registry;
+}
+
+RpcLocalRegistry::RpcLocalRegistry()
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    m_enabled = config.Load("rpc_local_calls") != "false";
+    m_isolation = config.Load("rpc_local_isolation") == "true";
+}
+
+void RpcLocalRegistry::Add(google::protobuf::Service *service, std::shared_ptr<void> owner,
+                           const std::vector<const google::protobuf::MethodDescriptor *> &methods)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry &entry = m_services[service->GetDescriptor()];
+    entry.service = service;
+    entry.owner = std::move(owner);
+    entry.methods.clear();
+    entry.methods.insert(methods.begin(), methods.end());
+}
+
+void RpcLocalRegistry::Remove(google::protobuf::Service *service)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_services.find(service->GetDescriptor());
+    if (it != m_services.end() && it->second.service == service)
+    {
+        m_services.erase(it);
+    }
+}
+
+bool RpcLocalRegistry::Call(const google::protobuf::MethodDescriptor *method, google::protobuf::RpcController *controller,
+                            const google::protobuf::Message *request, google::protobuf::Message *response)
+{
+    if (!m_enabled)
+    {
+        return false;
+    }
+    google::protobuf::Service *service = nullptr;
+    std::shared_ptr<void> owner;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_services.find(method->service());
+        if (it == m_services.end() || it->second.methods.count(method) == 0)
+        {
+            return false;
+        }
+        service = it->second.service;
+        owner = it->second.owner;
+    }
+
+    // 处理函数可能在别的线程中异步完成，等done执行之后再返回，和走网络的调用一样是同步的
+    muduo::CountDownLatch latch(1);
+    google::protobuf::Closure *done = google::protobuf::NewCallback(&latch, &muduo::CountDownLatch::countDown);
+    if (!m_isolation)
+    {
+        // 直接把调用方的消息对象交给服务，不做任何复制
+        service->CallMethod(method, controller, request, response, done);
+        latch.wait();
+        return true;
+    }
+
+    // 隔离模式：服务拿到的是请求的副本，响应写在自己的副本上，两个副本都分配在arena上，调用结束一起释放
+    google::protobuf::Arena arena;
+    google::protobuf::Message *local_request = request->New(&arena);
+    google::protobuf::Message *local_response = response->New(&arena);
+    local_request->CopyFrom(*request);
+    service->CallMethod(method, controller, local_request, local_response, done);
+    latch.wait();
+    response->CopyFrom(*local_response);
+    return true;
+}
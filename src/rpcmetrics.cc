@@ -0,0 +1,335 @@
+#include "rpcmetrics.h"
+#include "rpcheader.pb.h"
+#include <cstdio>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+
+const int64_t RpcMetrics::kBucketBoundsUs[kBucketCount] = {
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 5000000};
+
+// 只有所属线程会写分片中的计数，用普通的读加写代替fetch_add，避免原子读改写的开销
+static inline void Add(std::atomic<uint64_t> &counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+static inline uint64_t Get(const std::atomic<uint64_t> &counter)
+{
+    return counter.load(std::memory_order_relaxed);
+}
+
+RpcMetrics::MethodCounters::MethodCounters() : requests(0), request_bytes(0), response_bytes(0)
+{
+    for (auto &s : status)
+    {
+        s.store(0, std::memory_order_relaxed);
+    }
+    for (Histogram *h : {&queue_time, &handler_time})
+    {
+        for (auto &b : h->buckets)
+        {
+            b.store(0, std::memory_order_relaxed);
+        }
+        h->sum_us.store(0, std::memory_order_relaxed);
+    }
+}
+
+RpcMetrics::ThreadShard::ThreadShard()
+{
+    for (auto &m : methods)
+    {
+        m.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+// 存活的RpcMetrics对象，线程退出时只把分片归还给还存在的对象
+static std::mutex g_liveMutex;
+static std::unordered_map<uint64_t, RpcMetrics *> g_live;
+static std::atomic<uint64_t> g_nextId{1};
+
+struct RpcMetrics::LocalShards
+{
+    std::vector<std::pair<uint64_t, ThreadShard *>> shards;
+
+    ~LocalShards()
+    {
+        std::lock_guard<std::mutex> live_lock(g_liveMutex);
+        for (auto &p : shards)
+        {
+            auto it = g_live.find(p.first);
+            if (it != g_live.end())
+            {
+                std::lock_guard<std::mutex> lock(it->second->m_mutex);
+                it->second->RetireShard(p.second);
+            }
+        }
+    }
+};
+
+RpcMetrics::RpcMetrics() : m_names(kMaxMethods), m_id(g_nextId.fetch_add(1))
+{
+    m_names[kUnknownMethod].service = "unknown";
+    m_names[kUnknownMethod].method = "unknown";
+    std::lock_guard<std::mutex> lock(g_liveMutex);
+    g_live[m_id] = this;
+}
+
+RpcMetrics::~RpcMetrics()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_liveMutex);
+        g_live.erase(m_id);
+    }
+    // 还在运行的线程的分片表里留着这个对象的编号，之后不会再匹配，分片可以直接释放
+    m_shards.insert(m_shards.end(), m_freeShards.begin(), m_freeShards.end());
+    m_shards.push_back(&m_retired);
+    for (ThreadShard *shard : m_shards)
+    {
+        for (auto &m : shard->methods)
+        {
+            delete m.load(std::memory_order_relaxed);
+        }
+        if (shard != &m_retired)
+        {
+            delete shard;
+        }
+    }
+}
+
+void RpcMetrics::AddMethod(uint32_t method_id, const std::string &service_name, const std::string &method_name)
+{
+    if (method_id >= kUnknownMethod)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_names[method_id].service = service_name;
+    m_names[method_id].method = method_name;
+}
+
+RpcMetrics::ThreadShard *RpcMetrics::LocalShard()
+{
+    // 一个线程可能给多个RpcMetrics对象记录，按对象缓存各自的分片
+    thread_local LocalShards local;
+    for (auto &p : local.shards)
+    {
+        if (p.first == m_id)
+        {
+            return p.second;
+        }
+    }
+    {
+        // 顺便丢掉已经析构的对象留下的表项
+        std::lock_guard<std::mutex> lock(g_liveMutex);
+        auto dead = [](const std::pair<uint64_t, ThreadShard *> &p) { return g_live.count(p.first) == 0; };
+        local.shards.erase(std::remove_if(local.shards.begin(), local.shards.end(), dead), local.shards.end());
+    }
+    ThreadShard *shard;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_freeShards.empty())
+        {
+            shard = m_freeShards.back();
+            m_freeShards.pop_back();
+        }
+        else
+        {
+            shard = new ThreadShard;
+        }
+        m_shards.push_back(shard);
+    }
+    local.shards.emplace_back(m_id, shard);
+    return shard;
+}
+
+void RpcMetrics::Merge(MethodCounters *to, MethodCounters *from)
+{
+    // 调用时两边都没有其他线程在写，读出后清零
+    auto move = [](std::atomic<uint64_t> &dst, std::atomic<uint64_t> &src) {
+        Add(dst, Get(src));
+        src.store(0, std::memory_order_relaxed);
+    };
+    move(to->requests, from->requests);
+    for (int s = 0; s < kStatusCount; s++)
+    {
+        move(to->status[s], from->status[s]);
+    }
+    move(to->request_bytes, from->request_bytes);
+    move(to->response_bytes, from->response_bytes);
+    for (int i = 0; i <= kBucketCount; i++)
+    {
+        move(to->queue_time.buckets[i], from->queue_time.buckets[i]);
+        move(to->handler_time.buckets[i], from->handler_time.buckets[i]);
+    }
+    move(to->queue_time.sum_us, from->queue_time.sum_us);
+    move(to->handler_time.sum_us, from->handler_time.sum_us);
+}
+
+void RpcMetrics::RetireShard(ThreadShard *shard)
+{
+    for (uint32_t id = 0; id < kMaxMethods; id++)
+    {
+        MethodCounters *from = shard->methods[id].load(std::memory_order_acquire);
+        if (from == nullptr)
+        {
+            continue;
+        }
+        MethodCounters *to = m_retired.methods[id].load(std::memory_order_relaxed);
+        if (to == nullptr)
+        {
+            to = new MethodCounters;
+            m_retired.methods[id].store(to, std::memory_order_release);
+        }
+        Merge(to, from);
+    }
+    m_shards.erase(std::find(m_shards.begin(), m_shards.end(), shard));
+    m_freeShards.push_back(shard);
+}
+
+void RpcMetrics::Observe(Histogram &histogram, int64_t value_us)
+{
+    int i = 0;
+    while (i < kBucketCount && value_us > kBucketBoundsUs[i])
+    {
+        i++;
+    }
+    Add(histogram.buckets[i], 1);
+    Add(histogram.sum_us, value_us < 0 ? 0 : value_us);
+}
+
+void RpcMetrics::Record(uint32_t method_id, int status, int64_t queue_us, int64_t handler_us,
+                        uint32_t request_bytes, uint32_t response_bytes)
+{
+    if (method_id >= kMaxMethods)
+    {
+        return;
+    }
+    ThreadShard *shard = LocalShard();
+    MethodCounters *counters = shard->methods[method_id].load(std::memory_order_acquire);
+    if (counters == nullptr)
+    {
+        counters = new MethodCounters;
+        shard->methods[method_id].store(counters, std::memory_order_release);
+    }
+
+    Add(counters->requests, 1);
+    Add(counters->status[status >= 0 && status < kStatusCount ? status : mprpc::RPC_INTERNAL], 1);
+    Add(counters->request_bytes, request_bytes);
+    Add(counters->response_bytes, response_bytes);
+    if (queue_us >= 0)
+    {
+        Observe(counters->queue_time, queue_us);
+        Observe(counters->handler_time, handler_us);
+    }
+}
+
+void RpcMetrics::RenderHistogram(std::string *out, const char *name, const std::string &labels,
+                                 const std::vector<const Histogram *> &histograms)
+{
+    char line[256];
+    uint64_t cumulative = 0;
+    uint64_t sum_us = 0;
+    for (int i = 0; i <= kBucketCount; i++)
+    {
+        for (const Histogram *h : histograms)
+        {
+            cumulative += Get(h->buckets[i]);
+        }
+        if (i < kBucketCount)
+        {
+            snprintf(line, sizeof(line), "%s_bucket{%s,le=\"%g\"} %lu\n", name, labels.c_str(),
+                     kBucketBoundsUs[i] / 1e6, cumulative);
+        }
+        else
+        {
+            snprintf(line, sizeof(line), "%s_bucket{%s,le=\"+Inf\"} %lu\n", name, labels.c_str(), cumulative);
+        }
+        *out += line;
+    }
+    for (const Histogram *h : histograms)
+    {
+        sum_us += Get(h->sum_us);
+    }
+    snprintf(line, sizeof(line), "%s_sum{%s} %g\n%s_count{%s} %lu\n", name, labels.c_str(), sum_us / 1e6,
+             name, labels.c_str(), cumulative);
+    *out += line;
+}
+
+void RpcMetrics::Render(std::string *out)
+{
+    // 整个抓取持有锁，线程退出时的合并和清零不会和累加交错，重复计数或者漏掉
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const std::vector<MethodName> &names = m_names;
+    std::vector<ThreadShard *> shards = m_shards;
+    shards.push_back(&m_retired);
+
+    std::string requests = "# TYPE mprpc_requests_total counter\n";
+    std::string responses = "# TYPE mprpc_responses_total counter\n";
+    std::string request_bytes = "# TYPE mprpc_request_bytes_total counter\n";
+    std::string response_bytes = "# TYPE mprpc_response_bytes_total counter\n";
+    std::string queue_time = "# TYPE mprpc_queue_time_seconds histogram\n";
+    std::string handler_time = "# TYPE mprpc_handler_time_seconds histogram\n";
+
+    char line[256];
+    for (uint32_t id = 0; id < kMaxMethods; id++)
+    {
+        std::vector<const MethodCounters *> counters;
+        for (ThreadShard *shard : shards)
+        {
+            const MethodCounters *c = shard->methods[id].load(std::memory_order_acquire);
+            if (c != nullptr)
+            {
+                counters.push_back(c);
+            }
+        }
+        if (counters.empty() || names[id].method.empty())
+        {
+            continue;
+        }
+
+        std::string labels = "service=\"" + names[id].service + "\",method=\"" + names[id].method + "\"";
+        uint64_t total = 0, req = 0, resp = 0;
+        uint64_t status[kStatusCount] = {0};
+        std::vector<const Histogram *> queue, handler;
+        for (const MethodCounters *c : counters)
+        {
+            total += Get(c->requests);
+            req += Get(c->request_bytes);
+            resp += Get(c->response_bytes);
+            for (int s = 0; s < kStatusCount; s++)
+            {
+                status[s] += Get(c->status[s]);
+            }
+            queue.push_back(&c->queue_time);
+            handler.push_back(&c->handler_time);
+        }
+
+        snprintf(line, sizeof(line), "mprpc_requests_total{%s} %lu\n", labels.c_str(), total);
+        requests += line;
+        for (int s = 0; s < kStatusCount; s++)
+        {
+            if (status[s] == 0)
+            {
+                continue;
+            }
+            const std::string &status_name = mprpc::RpcStatus_IsValid(s) ? mprpc::RpcStatus_Name(s) : std::to_string(s);
+            snprintf(line, sizeof(line), "mprpc_responses_total{%s,status=\"%s\"} %lu\n", labels.c_str(),
+                     status_name.c_str(), status[s]);
+            responses += line;
+        }
+        snprintf(line, sizeof(line), "mprpc_request_bytes_total{%s} %lu\n", labels.c_str(), req);
+        request_bytes += line;
+        snprintf(line, sizeof(line), "mprpc_response_bytes_total{%s} %lu\n", labels.c_str(), resp);
+        response_bytes += line;
+        RenderHistogram(&queue_time, "mprpc_queue_time_seconds", labels, queue);
+        RenderHistogram(&handler_time, "mprpc_handler_time_seconds", labels, handler);
+    }
+
+    *out += requests;
+    *out += responses;
+    *out += request_bytes;
+    *out += response_bytes;
+    *out += queue_time;
+    *out += handler_time;
+}
@@ -3,10 +3,48 @@
 #include "rpcheader.pb.h"
 #include "logger.h"
 #include "zookeeperutil.h"
+#include "rpcaffinity.h"
+#include "rpchotrestart.h"
+#include "rpclocalregistry.h"
+#include <muduo/base/CountDownLatch.h>
+#include <algorithm>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+//信号处理函数和事件循环之间的通知管道
+static int s_signalPipe[2] = {-1, -1};
+
+static void SignalHandler(int signo)
+{
+    char c = static_cast<char>(signo);
+    ssize_t n = write(s_signalPipe[1], &c, 1);
+    (void)n;
+}
+
+RpcProvider::RpcProvider()
+    : m_serviceMap(new ServiceMap), m_registered(false), m_flushCount(0), m_flushedResponces(0), m_highWaterMark(0), m_maxFrameBytes(0), m_pausedConnections(0),
+      m_backpressureEvents(0), m_inputBytes(0), m_outputBytes(0), m_activeStreams(RpcMetrics::kMaxMethods), m_connections(0), m_hotRestartListenFd(-1), m_handoffFd(-1),
+      m_handedOff(false), m_handoffReady(false), m_handingOff(false), m_handoffRemaining(0),
+      m_draining(false), m_rejectNew(false), m_drainDeadline(0)
+{
+}
+
+RpcProvider::~RpcProvider()
+{
+    //进程内的调用方不能再直连到这个provider发布的服务
+    const ServiceMap *services=m_serviceMap.load();
+    for(auto &sp : *services)
+    {
+        RpcLocalRegistry::GetInstance().Remove(sp.second->m_service);
+    }
+    delete services;
+}
 
 void RpcProvider::NotifyService(google::protobuf::Service *service)
 {
-    ServiceInfo service_info;
+    std::shared_ptr<ServiceInfo> info=std::make_shared<ServiceInfo>();
+    ServiceInfo &service_info=*info;
     //获取服务对象的描述信息
     const google::protobuf::ServiceDescriptor *pserviceDesc=service->GetDescriptor();
     //获取服务名字
@@ -16,16 +54,206 @@ void RpcProvider::NotifyService(google::protobuf::Service *service)
 
     LOG_INFO("service name:%s",service_name.c_str());
 
+    //方法的配置在加锁之前读好，方法编号和调度队列在锁内分配
+    struct MethodConfig
+    {
+        std::string key;
+        int max_concurrency;
+        RpcPriority priority;
+    };
+    std::vector<MethodConfig> method_configs(methodCnt);
+    MprpcConfig &config=MprpcApplication::GetInstance().GetConfig();
     for(int i=0;i<methodCnt;i++)
     {
         //获得服务对象指定下标服务方法的描述（抽象描述）
         const google::protobuf::MethodDescriptor* _pmethodDesc=pserviceDesc->method(i);
         std::string method_name=_pmethodDesc->name();
-        service_info.m_methodMap.insert({method_name,_pmethodDesc});
-        LOG_INFO("method name:%s",method_name.c_str());
+
+        //方法的并发上限和优先级，例如 UserServiceRpc.Login.priority=critical
+        //FriendServiceRpc.GetFriendList.max_concurrency=4
+        std::string key=service_name+"."+method_name;
+        int max_concurrency=atoi(config.Load(key+".max_concurrency").c_str());
+        RpcPriority priority=ParseRpcPriority(config.Load(key+".priority"));
+        //幂等方法可以开启响应缓存，例如 FriendServiceRpc.GetFriendList.cache_ttl_ms=500
+        //或者只开启相同请求的合并执行，例如 FriendServiceRpc.GetFriendList.idempotent=true，开启缓存的方法同样会合并
+        //流式方法两者都不支持
+        int64_t cache_ttl_ms=atoi(config.Load(key+".cache_ttl_ms").c_str());
+        bool coalesce=cache_ttl_ms>0||config.Load(key+".idempotent")=="true";
+        //大的bytes字段引用输入数据而不复制，例如 FileServiceRpc.Upload.alias_bytes=4096
+        int alias_bytes=atoi(config.Load(key+".alias_bytes").c_str());
+        //流式方法同时进行的流数上限，例如 LogServiceRpc.Tail.max_streams=8，不配置时为工作线程数的一半
+        int max_streams=atoi(config.Load(key+".max_streams").c_str());
+        if(_pmethodDesc->client_streaming()||_pmethodDesc->server_streaming())
+        {
+            cache_ttl_ms=0;
+            coalesce=false;
+            alias_bytes=0;
+        }
+
+        MethodInfo method_info;
+        method_info.m_descriptor=_pmethodDesc;
+        method_info.m_queue=nullptr;
+        method_info.m_id=0;
+        method_info.m_cacheTtlUs=cache_ttl_ms*1000;
+        method_info.m_coalesce=coalesce;
+        method_info.m_aliasBytes=alias_bytes>0 ? alias_bytes : 0;
+        method_info.m_maxStreams=max_streams>0 ? max_streams : 0;
+        //响应的压缩，例如 FriendServiceRpc.GetFriendList.compress=zstd，流式方法的消息逐条发送，不压缩
+        if(!_pmethodDesc->client_streaming()&&!_pmethodDesc->server_streaming())
+        {
+            method_info.m_compress=RpcCompressor::LoadPolicy(service_name,method_name);
+        }
+        service_info.m_methodMap.insert({method_name,method_info});
+        method_configs[i]={key,max_concurrency,priority};
     }
     service_info.m_service=service;
-    m_serviceMap.insert({service_name,service_info});
+
+    //重复检查、方法编号的分配和服务表的替换在同一个临界区内完成，并发注册同名服务时后来的一方不会留下任何状态
+    std::lock_guard<std::mutex> lock(m_registerMutex);
+    const ServiceMap *current=m_serviceMap.load(std::memory_order_acquire);
+    if(current->count(service_name)>0)
+    {
+        LOG_ERR("service %s is already registered!",service_name.c_str());
+        return;
+    }
+    //方法编号按"服务.方法"分配，同一个方法注销后重新注册时沿用原来的编号和调度队列，
+    //反复注册注销不会耗尽指标和限流的方法表。编号用完时拒绝注册，而不是让新方法和其他方法共用统计
+    size_t new_methods=0;
+    for(const MethodConfig &mc : method_configs)
+    {
+        new_methods+=m_methodSlots.count(mc.key)==0 ? 1 : 0;
+    }
+    if(m_methodSlots.size()+new_methods>RpcMetrics::kUnknownMethod)
+    {
+        LOG_ERR("service %s is not registered: %zu methods exceed the limit of %u",
+                service_name.c_str(),m_methodSlots.size()+new_methods,RpcMetrics::kUnknownMethod);
+        return;
+    }
+    for(int i=0;i<methodCnt;i++)
+    {
+        const MethodConfig &mc=method_configs[i];
+        MethodInfo &method_info=service_info.m_methodMap[pserviceDesc->method(i)->name()];
+        auto slot=m_methodSlots.find(mc.key);
+        if(slot==m_methodSlots.end())
+        {
+            MethodSlot new_slot;
+            new_slot.m_id=static_cast<uint32_t>(m_methodSlots.size());
+            new_slot.m_queue=m_scheduler.AddMethod(mc.key,mc.max_concurrency,mc.priority);
+            slot=m_methodSlots.insert({mc.key,new_slot}).first;
+        }
+        method_info.m_id=slot->second.m_id;
+        method_info.m_queue=slot->second.m_queue;
+        m_metrics.AddMethod(method_info.m_id,service_name,pserviceDesc->method(i)->name());
+        //方法的限流，例如 FriendServiceRpc.GetFriendList.rate_limit_qps=5000
+        m_rateLimiter.SetMethodLimit(method_info.m_id,atof(config.Load(mc.key+".rate_limit_qps").c_str()),
+                                     atof(config.Load(mc.key+".rate_limit_burst").c_str()));
+        LOG_INFO("method name:%s id:%u max_concurrency:%d priority:%s cache_ttl_ms:%ld coalesce:%d alias_bytes:%u compress:%d",
+                 pserviceDesc->method(i)->name().c_str(),method_info.m_id,mc.max_concurrency,RpcPriorityName(mc.priority),
+                 method_info.m_cacheTtlUs/1000,method_info.m_coalesce,method_info.m_aliasBytes,method_info.m_compress.codec);
+    }
+
+    ServiceMap *services=new ServiceMap(*current);
+    services->insert({service_name,info});
+    PublishServiceMap(services);
+
+    //同一进程中的调用方可以直接调用，流式方法和引用解析的方法需要provider提供的controller，仍然走网络
+    std::vector<const google::protobuf::MethodDescriptor*> local_methods;
+    for(auto &mp : service_info.m_methodMap)
+    {
+        const google::protobuf::MethodDescriptor *desc=mp.second.m_descriptor;
+        if(!desc->client_streaming()&&!desc->server_streaming()&&mp.second.m_aliasBytes==0)
+        {
+            local_methods.push_back(desc);
+        }
+    }
+    RpcLocalRegistry::GetInstance().Add(service,info,local_methods);
+    //运行中注册的服务立即在zookeeper上注册实例节点，启动前注册的服务由Run统一注册
+    if(m_registered&&!m_draining)
+    {
+        RegisterInstances(service_name,service_info);
+    }
+}
+
+bool RpcProvider::UnregisterService(const std::string &service_name, std::function<void()> on_removed)
+{
+    std::lock_guard<std::mutex> lock(m_registerMutex);
+    const ServiceMap *current=m_serviceMap.load(std::memory_order_acquire);
+    auto it=current->find(service_name);
+    if(it==current->end())
+    {
+        return false;
+    }
+    //先注销实例节点，nginx和调用方不再把请求路由过来
+    for(const std::string &path : m_instancePaths[service_name])
+    {
+        m_zkClient->Delete(path.c_str());
+    }
+    m_instancePaths.erase(service_name);
+
+    RpcLocalRegistry::GetInstance().Remove(it->second->m_service);
+    it->second->m_onRemoved=std::move(on_removed);
+    ServiceMap *services=new ServiceMap(*current);
+    services->erase(service_name);
+    PublishServiceMap(services);
+    LOG_INFO("service %s unregistered",service_name.c_str());
+    return true;
+}
+
+void RpcProvider::PublishServiceMap(const ServiceMap *services)
+{
+    //读者只在很短的查找期间持有旧表，等它们离开后同步释放
+    const ServiceMap *old=m_serviceMap.exchange(services);
+    RpcEpoch::Synchronize();
+    delete old;
+}
+
+std::shared_ptr<RpcProvider::ServiceInfo> RpcProvider::FindService(const std::string &service_name)
+{
+    RpcEpoch::ReadGuard guard;
+    const ServiceMap *services=m_serviceMap.load();
+    auto it=services->find(service_name);
+    return it!=services->end() ? it->second : nullptr;
+}
+
+void RpcProvider::RegisterInstances(const std::string &service_name, const ServiceInfo &service_info)
+{
+    std::string ip = MprpcApplication::GetInstance().GetConfig().Load("rpcserverip");
+    uint16_t port = atoi(MprpcApplication::GetInstance().GetConfig().Load("rpcserverport").c_str());
+    ZkClient &zkCli = *m_zkClient;
+
+    // 1. 创建服务根节点（持久节点）
+    std::string service_root = "/" + service_name;
+    if (!zkCli.Exists(service_root.c_str())) {
+        zkCli.Create(service_root.c_str(), nullptr, 0, 0); // 0表示持久节点
+        LOG_INFO("Created service root: %s", service_root.c_str());
+    }
+
+    // 2. 为每个方法创建实例节点
+    for (auto &mp : service_info.m_methodMap) {
+        // 方法节点路径
+        std::string method_path = service_root + "/" + mp.first;
+
+        // 如果方法节点不存在，则创建
+        if (!zkCli.Exists(method_path.c_str())) {
+            zkCli.Create(method_path.c_str(), nullptr, 0, 0); // 持久节点
+            LOG_INFO("Created method node: %s", method_path.c_str());
+        }
+
+        // 3. 在方法节点下创建服务实例节点（临时顺序节点）
+        // 开放了unix socket时附带路径，同机的调用方据此直连："ip:port unix=路径"
+        std::string instance_path = method_path + "/instance-";
+        std::string instance_data = ip + ":" + std::to_string(port);
+        if (m_unixListener) {
+            instance_data += " unix=" + m_unixPath;
+        }
+
+        // 创建临时顺序节点
+        std::string created_path = zkCli.Create(instance_path.c_str(), instance_data.c_str(), instance_data.size(), ZOO_EPHEMERAL | ZOO_SEQUENCE);
+        if (!created_path.empty()) {
+            m_instancePaths[service_name].push_back(created_path);
+        }
+        LOG_INFO("Registered service instance: %s at %s", created_path.c_str(), instance_data.c_str());
+    }
 }
 
 void RpcProvider::Run() {
@@ -34,11 +262,9 @@ void RpcProvider::Run() {
     muduo::net::InetAddress address(ip, port);
 
     // 创建TcpServer对象
-    muduo::net::TcpServer server(&m_eventLoop, address, "RpcProvider");
-    server.setConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
-    server.setMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1,
-                        std::placeholders::_2, std::placeholders::_3));
-    server.setThreadNum(4);
+    int io_threads = CreateServers(address);
+
+    CreateUnixListener();
 
     // 获取ZooKeeper配置
     std::string zk_ip = MprpcApplication::GetInstance().GetConfig().Load("zookeeperip");
@@ -51,7 +277,8 @@ void RpcProvider::Run() {
     std::string zk_host = zk_ip + ":" + zk_port;
 
     // 使用正确的ZooKeeper地址
-    ZkClient zkCli(zk_host);
+    m_zkClient.reset(new ZkClient(zk_host));
+    ZkClient &zkCli = *m_zkClient;
     zkCli.Start();
 
     // 等待连接建立
@@ -62,146 +289,1351 @@ void RpcProvider::Run() {
     }
 
     // 集群模式注册服务
-    for (auto &sp : m_serviceMap) {
-        // 1. 创建服务根节点（持久节点）
-        std::string service_root = "/" + sp.first;
-        if (!zkCli.Exists(service_root.c_str())) {
-            zkCli.Create(service_root.c_str(), nullptr, 0, 0); // 0表示持久节点
-            LOG_INFO("Created service root: %s", service_root.c_str());
-        }
-        
-        // 2. 为每个方法创建实例节点
-        for (auto &mp : sp.second.m_methodMap) {
-            // 方法节点路径
-            std::string method_path = service_root + "/" + mp.first;
-            
-            // 如果方法节点不存在，则创建
-            if (!zkCli.Exists(method_path.c_str())) {
-                zkCli.Create(method_path.c_str(), nullptr, 0, 0); // 持久节点
-                LOG_INFO("Created method node: %s", method_path.c_str());
-            }
-            
-            // 3. 在方法节点下创建服务实例节点（临时顺序节点）
-            std::string instance_path = method_path + "/instance-";
-            char instance_data[128];
-            snprintf(instance_data, sizeof(instance_data), "%s:%d", ip.c_str(), port);
-            
-            // 创建临时顺序节点
-            zkCli.Create(instance_path.c_str(), instance_data, strlen(instance_data), ZOO_EPHEMERAL | ZOO_SEQUENCE);
-            LOG_INFO("Registered service instance: %s at %s", instance_path.c_str(), instance_data);
+    {
+        std::lock_guard<std::mutex> lock(m_registerMutex);
+        for (auto &sp : *m_serviceMap.load()) {
+            RegisterInstances(sp.first, *sp.second);
         }
+        m_registered = true;
     }
 
-    // 启动服务
-    LOG_INFO("RPC Provider starting at %s:%d", ip.c_str(), port);
-    server.start();
+    m_admission.Init();
+    m_cache.Init();
+    m_rateLimiter.Init();
+    m_scheduler.SetThreadInitCallback([]() { RpcAffinity::GetInstance().BindCurrentThread("worker"); });
+    m_scheduler.Start(atoi(MprpcApplication::GetInstance().GetConfig().Load("rpc_worker_threads").c_str()));
+    SetupSignalHandler();
+
+    // metrics_port：Prometheus指标的http端口，不配置则不开启，http服务跑在主loop上
+    std::string metrics_port = MprpcApplication::GetInstance().GetConfig().Load("metrics_port");
+    if (!metrics_port.empty()) {
+        muduo::net::InetAddress metrics_address(ip, atoi(metrics_port.c_str()));
+        m_metricsServer.reset(new muduo::net::TcpServer(&m_eventLoop, metrics_address, "RpcMetrics"));
+        m_metricsServer->setMessageCallback(std::bind(&RpcProvider::OnMetricsMessage, this, std::placeholders::_1,
+                                                      std::placeholders::_2, std::placeholders::_3));
+        m_metricsServer->start();
+        LOG_INFO("metrics endpoint at http://%s:%s/metrics", ip.c_str(), metrics_port.c_str());
+    }
+
+    // 启动服务，TcpServer::start需要在它所属的loop线程中调用
+    LOG_INFO("RPC Provider starting at %s:%d with %d io threads, %lu listeners",
+             ip.c_str(), port, io_threads, m_servers.size());
+    for (auto &server : m_servers) {
+        muduo::net::TcpServer *ps = server.get();
+        ps->getLoop()->runInLoop([ps]() { ps->start(); });
+    }
+    if (m_listener) {
+        m_listener->Start();
+        SetupHotRestart();
+    }
+    if (m_unixListener) {
+        m_unixListener->Start();
+    }
+    StartTransports();
+    // 单TcpServer模式下io线程在start中同步创建，这里所有线程都已经完成绑核
+    RpcAffinity::GetInstance().Report();
     m_eventLoop.loop();
+
+    // 下线流程结束，依次停止线程池、关闭连接、断开zookeeper
+    LOG_INFO("RPC Provider at %s:%d stopped", ip.c_str(), port);
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        for (RpcServerStream *stream : m_streams) {
+            stream->Cancel();
+        }
+    }
+    m_scheduler.Stop();
+    m_transports.clear();
+    // 创建信号管道失败时没有信号通道
+    if (m_signalChannel) {
+        m_signalChannel->disableAll();
+        m_signalChannel->remove();
+        m_signalChannel.reset();
+    }
+    DestroyServers();
+    m_metricsServer.reset();
+    m_zkClient.reset();
+}
+
+void RpcProvider::OnMetricsMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buffer, muduo::Timestamp)
+{
+    //等读到完整的请求头再处理，每个连接只响应一次
+    std::string request(buffer->peek(), buffer->readableBytes());
+    if (request.find("\r\n\r\n") == std::string::npos) {
+        return;
+    }
+    buffer->retrieveAll();
+
+    std::string status = "200 OK";
+    std::string body;
+    if (request.compare(0, 13, "GET /metrics ") == 0 || request.compare(0, 6, "GET / ") == 0) {
+        RenderMetrics(&body);
+    } else {
+        status = "404 Not Found";
+        body = "not found\n";
+    }
+    std::string response = "HTTP/1.1 " + status + "\r\n"
+                           "Content-Type: text/plain; version=0.0.4\r\n"
+                           "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                           "Connection: close\r\n\r\n";
+    response += body;
+    conn->send(response);
+    conn->shutdown();
+}
+
+void RpcProvider::RenderMetrics(std::string *out)
+{
+    m_metrics.Render(out);
+
+    //连接、线程池和框架内部的计数
+    int running = 0;
+    size_t queued = 0;
+    m_scheduler.Stats(&running, &queued);
+    char text[4096];
+    snprintf(text, sizeof(text),
+             "# TYPE mprpc_connections gauge\nmprpc_connections %d\n"
+             "# TYPE mprpc_inflight gauge\nmprpc_inflight %d\n"
+             "# TYPE mprpc_worker_threads gauge\nmprpc_worker_threads %d\n"
+             "# TYPE mprpc_worker_busy gauge\nmprpc_worker_busy %d\n"
+             "# TYPE mprpc_worker_queued gauge\nmprpc_worker_queued %lu\n"
+             "# TYPE mprpc_admission_rejected_total counter\nmprpc_admission_rejected_total %lu\n"
+             "# TYPE mprpc_throttled_total counter\nmprpc_throttled_total %lu\n"
+             "# TYPE mprpc_cache_hits_total counter\nmprpc_cache_hits_total %lu\n"
+             "# TYPE mprpc_cache_misses_total counter\nmprpc_cache_misses_total %lu\n"
+             "# TYPE mprpc_coalesced_total counter\nmprpc_coalesced_total %lu\n"
+             "# TYPE mprpc_write_flushes_total counter\nmprpc_write_flushes_total %lu\n"
+             "# TYPE mprpc_flushed_responses_total counter\nmprpc_flushed_responses_total %lu\n"
+             "# TYPE mprpc_draining gauge\nmprpc_draining %d\n"
+             "# TYPE mprpc_buffer_bytes gauge\nmprpc_buffer_bytes{direction=\"input\"} %ld\n"
+             "mprpc_buffer_bytes{direction=\"output\"} %ld\n"
+             "# TYPE mprpc_paused_connections gauge\nmprpc_paused_connections %d\n"
+             "# TYPE mprpc_backpressure_total counter\nmprpc_backpressure_total %lu\n",
+             m_connections.load(), m_admission.InFlight(), m_scheduler.ThreadNum(), running, queued,
+             m_admission.Rejected(), m_rateLimiter.Throttled(), m_cache.Hits(), m_cache.Misses(), m_singleflight.Coalesced(),
+             m_flushCount.load(), m_flushedResponces.load(), m_draining ? 1 : 0,
+             m_inputBytes.load(), m_outputBytes.load(), m_pausedConnections.load(), m_backpressureEvents.load());
+    *out += text;
+
+    //每个连接的缓冲大小，在处理请求和发送响应时更新
+    std::string input = "# TYPE mprpc_connection_buffer_bytes gauge\n";
+    std::string output;
+    std::lock_guard<std::mutex> lock(m_connMutex);
+    for (ConnContext *ctx : m_connContexts) {
+        snprintf(text, sizeof(text), "mprpc_connection_buffer_bytes{peer=\"%s\",direction=\"input\"} %lu\n",
+                 ctx->peer.c_str(), ctx->input_bytes.load());
+        input += text;
+        snprintf(text, sizeof(text), "mprpc_connection_buffer_bytes{peer=\"%s\",direction=\"output\"} %lu\n",
+                 ctx->peer.c_str(), ctx->output_bytes.load());
+        output += text;
+    }
+    *out += input;
+    *out += output;
+}
+
+int RpcProvider::CreateServers(const muduo::net::InetAddress &address)
+{
+    MprpcConfig &config = MprpcApplication::GetInstance().GetConfig();
+    // rpc_io_threads：io线程数，默认4
+    std::string io_threads_str = config.Load("rpc_io_threads");
+    int io_threads = io_threads_str.empty() ? 4 : atoi(io_threads_str.c_str());
+    // rpc_high_water_mark_kb：连接输出缓冲的高水位，默认16MB，0表示不限制
+    std::string high_water_str = config.Load("rpc_high_water_mark_kb");
+    m_highWaterMark = (high_water_str.empty() ? 16384 : atol(high_water_str.c_str())) * 1024;
+    // rpc_max_frame_bytes：一个请求帧的大小上限，默认64MB，请求头或者整帧声明的长度超过上限时断开连接，
+    // 避免按对端给出的长度无限制地缓存数据
+    std::string max_frame_str = config.Load("rpc_max_frame_bytes");
+    m_maxFrameBytes = max_frame_str.empty() ? 64 * 1024 * 1024 : atol(max_frame_str.c_str());
+
+    // rpc_io_engine：接管rpcserverip:rpcserverport的传输，默认muduo；uring、sim或者自行登记的传输启动失败时退回muduo
+    std::string engine = config.Load("rpc_io_engine");
+    if (!engine.empty() && engine != "muduo") {
+        m_engine = RpcTransportRegistry::GetInstance().CreateServer(engine);
+        if (m_engine && m_engine->Start(std::bind(&RpcProvider::OnInlineRequest, this, std::placeholders::_1,
+                                                  std::placeholders::_2, std::placeholders::_3))) {
+            return io_threads;
+        }
+        m_engine.reset();
+        LOG_ERR("io engine %s start failed, fall back to muduo", engine.c_str());
+    }
+
+    // hot_restart_path：热重启用的unix socket路径，配置后用RpcListener代替TcpServer，监听socket可以交给新进程
+    m_hotRestartPath = config.Load("hot_restart_path");
+    if (!m_hotRestartPath.empty()) {
+        CreateListener(address, io_threads);
+        return io_threads;
+    }
+
+    // rpc_reuseport=true：每个io线程独立监听同一端口，由内核把新连接分散到各个线程，
+    // 避免连接建立频繁时单个accept线程成为瓶颈
+    if (config.Load("rpc_reuseport") == "true" && io_threads > 0) {
+        m_ioLoopPool.reset(new muduo::net::EventLoopThreadPool(&m_eventLoop, "RpcProviderIo"));
+        m_ioLoopPool->setThreadNum(io_threads);
+        m_ioLoopPool->start([](muduo::net::EventLoop *) { RpcAffinity::GetInstance().BindCurrentThread("io"); });
+        for (muduo::net::EventLoop *loop : m_ioLoopPool->getAllLoops()) {
+            // 线程数保持0，连接就留在accept它的loop上处理
+            m_servers.emplace_back(new muduo::net::TcpServer(loop, address, "RpcProvider",
+                                                             muduo::net::TcpServer::kReusePort));
+        }
+    } else {
+        m_servers.emplace_back(new muduo::net::TcpServer(&m_eventLoop, address, "RpcProvider"));
+        m_servers.back()->setThreadNum(io_threads);
+        m_servers.back()->setThreadInitCallback([](muduo::net::EventLoop *) { RpcAffinity::GetInstance().BindCurrentThread("io"); });
+    }
+
+    for (auto &server : m_servers) {
+        server->setConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
+        server->setMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1,
+                            std::placeholders::_2, std::placeholders::_3));
+    }
+    return io_threads;
+}
+
+void RpcProvider::DestroyServers()
+{
+    m_engine.reset();
+
+    // TcpServer只能在所属的loop线程中析构
+    muduo::CountDownLatch latch(static_cast<int>(m_servers.size()));
+    for (auto &server : m_servers) {
+        muduo::net::EventLoop *loop = server->getLoop();
+        if (loop == &m_eventLoop) {
+            server.reset();
+            latch.countDown();
+        } else {
+            std::unique_ptr<muduo::net::TcpServer> *ps = &server;
+            loop->runInLoop([ps, &latch]() {
+                ps->reset();
+                latch.countDown();
+            });
+        }
+    }
+    latch.wait();
+    m_servers.clear();
+
+    // RpcListener在主loop中创建，也在这里销毁
+    m_listener.reset();
+    if (m_unixListener) {
+        m_unixListener.reset();
+        // 热重启时路径已经被新进程重新绑定
+        if (!m_handedOff) {
+            unlink(m_unixPath.c_str());
+        }
+    }
+    if (m_hotRestartChannel) {
+        m_hotRestartChannel->disableAll();
+        m_hotRestartChannel->remove();
+        m_hotRestartChannel.reset();
+        close(m_hotRestartListenFd);
+        // 监听socket交给新进程后路径已经属于新进程
+        if (!m_handedOff) {
+            unlink(m_hotRestartPath.c_str());
+        }
+    }
+    CloseHandoff();
+    m_ioLoopPool.reset();
+}
+
+void RpcProvider::CreateListener(const muduo::net::InetAddress &address, int io_threads)
+{
+    // 先找正在运行的旧进程要监听socket，旧进程交出之后新连接在socket的backlog中排队，不会被拒绝
+    int listen_fd = -1;
+    m_handoffFd = RpcHotRestart::Connect(m_hotRestartPath);
+    if (m_handoffFd != -1) {
+        RpcHotRestart::MessageType type;
+        std::string data;
+        if (!RpcHotRestart::Send(m_handoffFd, RpcHotRestart::kTakeListener, "") ||
+            !RpcHotRestart::Recv(m_handoffFd, &type, &data, &listen_fd) || type != RpcHotRestart::kListener || listen_fd == -1) {
+            LOG_ERR("take over listening socket from old provider failed, start cold");
+            close(m_handoffFd);
+            m_handoffFd = -1;
+        } else {
+            LOG_INFO("took over listening socket from old provider");
+        }
+    }
+    if (listen_fd == -1) {
+        listen_fd = RpcListener::Listen(address);
+        if (listen_fd == -1) {
+            exit(EXIT_FAILURE);
+        }
+    }
+    m_hotRestartListenFd = RpcHotRestart::Listen(m_hotRestartPath);
+
+    if (io_threads > 0) {
+        m_ioLoopPool.reset(new muduo::net::EventLoopThreadPool(&m_eventLoop, "RpcProviderIo"));
+        m_ioLoopPool->setThreadNum(io_threads);
+        m_ioLoopPool->start([](muduo::net::EventLoop *) { RpcAffinity::GetInstance().BindCurrentThread("io"); });
+    }
+    m_listener.reset(new RpcListener(&m_eventLoop, listen_fd, m_ioLoopPool.get()));
+    m_listener->SetConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
+    m_listener->SetMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1,
+                                             std::placeholders::_2, std::placeholders::_3));
+}
+
+void RpcProvider::CreateUnixListener()
+{
+    m_unixPath = MprpcApplication::GetInstance().GetConfig().Load("rpc_unix_path");
+    if (m_unixPath.empty()) {
+        return;
+    }
+    int fd = RpcListener::ListenUnix(m_unixPath);
+    if (fd == -1) {
+        return;
+    }
+    // 和TCP连接共用io线程，accept在主loop中进行
+    muduo::net::EventLoopThreadPool *pool = m_ioLoopPool.get();
+    if (pool == nullptr && !m_servers.empty()) {
+        pool = m_servers.front()->threadPool().get();
+    }
+    m_unixListener.reset(new RpcListener(&m_eventLoop, fd, pool));
+    m_unixListener->SetConnectionCallback(std::bind(&RpcProvider::OnConnection, this, std::placeholders::_1));
+    m_unixListener->SetMessageCallback(std::bind(&RpcProvider::OnMessage, this, std::placeholders::_1,
+                                                 std::placeholders::_2, std::placeholders::_3));
+    LOG_INFO("RPC Provider listening on unix socket %s", m_unixPath.c_str());
+}
+
+void RpcProvider::StartTransports()
+{
+    // rpc_transports：逗号分隔的传输名，和内建的TCP同时提供服务；配置了rpc_shm_path时自动开启shm
+    MprpcConfig &config = MprpcApplication::GetInstance().GetConfig();
+    std::vector<std::string> names;
+    std::string list = config.Load("rpc_transports");
+    for (size_t begin = 0; begin < list.size();) {
+        size_t end = list.find(',', begin);
+        end = end == std::string::npos ? list.size() : end;
+        if (end > begin) {
+            names.push_back(list.substr(begin, end - begin));
+        }
+        begin = end + 1;
+    }
+    if (!config.Load("rpc_shm_path").empty() && std::find(names.begin(), names.end(), "shm") == names.end()) {
+        names.push_back("shm");
+    }
+
+    for (const std::string &name : names) {
+        std::unique_ptr<RpcServerTransport> transport = RpcTransportRegistry::GetInstance().CreateServer(name);
+        if (!transport) {
+            LOG_ERR("unknown transport %s", name.c_str());
+            continue;
+        }
+        if (!transport->Start(std::bind(&RpcProvider::OnInlineRequest, this, std::placeholders::_1,
+                                        std::placeholders::_2, std::placeholders::_3))) {
+            LOG_ERR("transport %s start failed", name.c_str());
+            continue;
+        }
+        m_transports.push_back(std::move(transport));
+    }
+}
+
+void RpcProvider::SetupHotRestart()
+{
+    if (m_hotRestartListenFd != -1) {
+        m_hotRestartChannel.reset(new muduo::net::Channel(&m_eventLoop, m_hotRestartListenFd));
+        m_hotRestartChannel->setReadCallback(std::bind(&RpcProvider::OnHotRestartAccept, this, std::placeholders::_1));
+        m_hotRestartChannel->enableReading();
+    }
+    if (m_handoffFd != -1) {
+        // 新进程：已经在zookeeper上注册，通知旧进程注销并下线，之后接收它交出的连接
+        RpcHotRestart::Send(m_handoffFd, RpcHotRestart::kReady, "");
+        m_handoffChannel.reset(new muduo::net::Channel(&m_eventLoop, m_handoffFd));
+        m_handoffChannel->setReadCallback(std::bind(&RpcProvider::OnHandoffMessage, this, std::placeholders::_1));
+        m_handoffChannel->enableReading();
+    }
+}
+
+void RpcProvider::OnHotRestartAccept(muduo::Timestamp)
+{
+    // 交接连接使用阻塞读写，消息都很短
+    int fd = accept4(m_hotRestartListenFd, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd == -1) {
+        return;
+    }
+    if (m_handoffFd != -1 || m_draining) {
+        LOG_ERR("hot restart already in progress, reject another new provider");
+        close(fd);
+        return;
+    }
+    LOG_INFO("new provider connected for hot restart");
+    m_handoffFd = fd;
+    m_handoffChannel.reset(new muduo::net::Channel(&m_eventLoop, m_handoffFd));
+    m_handoffChannel->setReadCallback(std::bind(&RpcProvider::OnHandoffMessage, this, std::placeholders::_1));
+    m_handoffChannel->enableReading();
+}
+
+void RpcProvider::OnHandoffMessage(muduo::Timestamp)
+{
+    RpcHotRestart::MessageType type;
+    std::string data;
+    int fd = -1;
+    if (!RpcHotRestart::Recv(m_handoffFd, &type, &data, &fd)) {
+        if (m_handedOff && !m_handoffReady) {
+            // 新进程在完成注册之前退出了，旧进程恢复accept继续服务
+            LOG_ERR("new provider exited before ready, resume accepting");
+            m_handedOff = false;
+            m_listener->Start();
+        }
+        m_handoffChannel->disableAll();
+        m_eventLoop.queueInLoop(std::bind(&RpcProvider::CloseHandoff, this));
+        return;
+    }
+
+    switch (type) {
+    case RpcHotRestart::kTakeListener:
+        // 旧进程：交出监听socket后不再accept，同一个socket由新进程继续accept
+        if (RpcHotRestart::Send(m_handoffFd, RpcHotRestart::kListener, "", m_listener->ListenFd())) {
+            m_listener->StopAccepting();
+            m_handedOff = true;
+            LOG_INFO("listening socket handed over to new provider");
+        }
+        break;
+    case RpcHotRestart::kReady:
+        // 旧进程：新进程已经注册，开始下线
+        m_handoffReady = true;
+        m_handoffChannel->disableAll();
+        if (MprpcApplication::GetInstance().GetConfig().Load("hot_restart_connections") == "true") {
+            StartConnectionHandoff();
+        } else {
+            StartDrain();
+        }
+        break;
+    case RpcHotRestart::kConnection:
+        // 新进程：接管旧进程交出的连接
+        if (fd != -1) {
+            m_listener->Adopt(fd, data);
+        }
+        break;
+    case RpcHotRestart::kDone:
+        LOG_INFO("hot restart finished");
+        m_handoffChannel->disableAll();
+        m_eventLoop.queueInLoop(std::bind(&RpcProvider::CloseHandoff, this));
+        break;
+    default:
+        if (fd != -1) {
+            close(fd);
+        }
+        break;
+    }
+}
+
+void RpcProvider::CloseHandoff()
+{
+    if (m_handoffChannel) {
+        m_handoffChannel->disableAll();
+        m_handoffChannel->remove();
+        m_handoffChannel.reset();
+    }
+    if (m_handoffFd != -1) {
+        close(m_handoffFd);
+        m_handoffFd = -1;
+    }
+}
+
+void RpcProvider::StartConnectionHandoff()
+{
+    m_draining = true;
+    std::string timeout_str = MprpcApplication::GetInstance().GetConfig().Load("drain_timeout_ms");
+    int timeout_ms = timeout_str.empty() ? 10000 : atoi(timeout_str.c_str());
+    m_drainDeadline = RpcTracer::NowMicros() + static_cast<int64_t>(timeout_ms) * 1000;
+
+    // 新进程已经注册了同样的地址，注销不会让路由出现空档
+    {
+        std::lock_guard<std::mutex> lock(m_registerMutex);
+        for (const auto &sp : m_instancePaths) {
+            for (const std::string &path : sp.second) {
+                m_zkClient->Delete(path.c_str());
+            }
+        }
+        m_instancePaths.clear();
+    }
+
+    // 停止读取和处理请求，等处理中的请求完成后把连接连同没处理的数据一起交给新进程
+    LOG_INFO("start handing connections over to new provider, inflight:%d", m_admission.InFlight());
+    m_handingOff = true;
+    for (auto &item : m_listener->Connections()) {
+        muduo::net::TcpConnectionPtr conn = item.first;
+        conn->getLoop()->runInLoop([conn]() { conn->stopRead(); });
+    }
+    CheckHandoffDrained();
+}
+
+void RpcProvider::CheckHandoffDrained()
+{
+    if (m_admission.InFlight() > 0 && RpcTracer::NowMicros() < m_drainDeadline) {
+        m_eventLoop.runAfter(0.05, std::bind(&RpcProvider::CheckHandoffDrained, this));
+        return;
+    }
+    std::vector<std::pair<muduo::net::TcpConnectionPtr, int>> connections = m_listener->Connections();
+    m_handoffRemaining = static_cast<int>(connections.size());
+    if (connections.empty()) {
+        FinishHandoff();
+        return;
+    }
+    for (auto &item : connections) {
+        muduo::net::TcpConnectionPtr conn = item.first;
+        conn->getLoop()->runInLoop(std::bind(&RpcProvider::HandoffConnection, this, conn, item.second));
+    }
+}
+
+void RpcProvider::HandoffConnection(const muduo::net::TcpConnectionPtr &conn, int fd)
+{
+    if (conn->connected()) {
+        std::shared_ptr<ConnContext> ctx = boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+        bool unsent = conn->outputBuffer()->readableBytes() > 0 || ctx->pending.readableBytes() > 0;
+        if (unsent && RpcTracer::NowMicros() < m_drainDeadline) {
+            // 响应还没发完，稍后再交
+            conn->getLoop()->runAfter(0.01, std::bind(&RpcProvider::HandoffConnection, this, conn, fd));
+            return;
+        }
+
+        bool handed = false;
+        if (!unsent && ctx->streams.empty()) {
+            std::string input(conn->inputBuffer()->peek(), conn->inputBuffer()->readableBytes());
+            std::lock_guard<std::mutex> lock(m_handoffMutex);
+            handed = RpcHotRestart::Send(m_handoffFd, RpcHotRestart::kConnection, input, fd);
+        }
+        if (handed) {
+            // socket已经在新进程中，这里只关闭本进程的描述符，不能shutdown
+            conn->forceClose();
+        } else {
+            // 有进行中的流或者响应超时没发完的连接不交接，关闭后调用方重连到新进程
+            conn->shutdown();
+        }
+    }
+    if (--m_handoffRemaining == 0) {
+        m_eventLoop.runInLoop(std::bind(&RpcProvider::FinishHandoff, this));
+    }
+}
+
+void RpcProvider::FinishHandoff()
+{
+    LOG_INFO("connections handed over to new provider, quit");
+    {
+        std::lock_guard<std::mutex> lock(m_handoffMutex);
+        RpcHotRestart::Send(m_handoffFd, RpcHotRestart::kDone, "");
+    }
+    m_eventLoop.quit();
 }
 
 void RpcProvider::OnConnection(const muduo::net::TcpConnectionPtr &conn)
 {
-    if(!conn->connected())
+    if(conn->connected())
     {
-        //和rpc client的连接断开了
+        //连接上的响应先放进ConnContext，每轮事件循环合并发送一次
+        std::shared_ptr<ConnContext> ctx=std::make_shared<ConnContext>(this,conn);
+        ctx->peer=conn->peerAddress().toIpPort();
+        ctx->peer_ip=conn->peerAddress().toIp();
+        conn->setContext(ctx);
+        if(m_highWaterMark>0)
+        {
+            conn->setHighWaterMarkCallback(std::bind(&RpcProvider::OnHighWaterMark,this,std::placeholders::_1,std::placeholders::_2),m_highWaterMark);
+            conn->setWriteCompleteCallback(std::bind(&RpcProvider::OnWriteComplete,this,std::placeholders::_1));
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_connMutex);
+            m_connContexts.insert(ctx.get());
+        }
+        m_connections++;
+    }
+    else
+    {
+        //和rpc client的连接断开了，取消连接上进行中的流
+        std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+        for(auto &sp : ctx->streams)
+        {
+            sp.second->Cancel();
+        }
+        ctx->streams.clear();
+        if(ctx->paused)
+        {
+            m_pausedConnections--;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_connMutex);
+            m_connContexts.erase(ctx.get());
+        }
+        m_inputBytes-=ctx->input_bytes.exchange(0);
+        m_outputBytes-=ctx->output_bytes.exchange(0);
+        m_connections--;
         conn->shutdown();
     }
 }
 
-void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, 
-                            muduo::net::Buffer *buffer, 
-                            muduo::Timestamp)
+void RpcProvider::SetupSignalHandler()
 {
-    //网络上接受的远程rpc请求的字符流 Login args
-    std::string recv_buf=buffer->retrieveAllAsString();
+    if (pipe2(s_signalPipe, O_NONBLOCK | O_CLOEXEC) == -1)
+    {
+        LOG_ERR("create signal pipe error! errno:%d", errno);
+        return;
+    }
 
-    //从字符流读取前4个字节的内容
-    uint32_t header_size=0;
-    uint32_t net_header_size = 0;
-    recv_buf.copy(reinterpret_cast<char*>(&net_header_size), 4, 0);
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = SignalHandler;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGUSR1, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+    sigaction(SIGINT, &sa, nullptr);
 
-    // 将网络字节序转换为主机字节序
-    header_size = ntohl(net_header_size);
-    
-    //根据header_size读取数据头的原始字符流，反序列化数据，得到rpc请求的详细信息
-    std::string rpc_header_str=recv_buf.substr(4,header_size);
+    m_signalChannel.reset(new muduo::net::Channel(&m_eventLoop, s_signalPipe[0]));
+    m_signalChannel->setReadCallback(std::bind(&RpcProvider::OnSignal, this, std::placeholders::_1));
+    m_signalChannel->enableReading();
+}
 
-    mprpc::RpcHeader rpcHeader;
-    std::string service_name;
-    std::string method_name;
-    uint32_t args_size;
-    if(rpcHeader.ParseFromString(rpc_header_str))
+void RpcProvider::OnSignal(muduo::Timestamp)
+{
+    char signals[16];
+    ssize_t n = 0;
+    while ((n = read(s_signalPipe[0], signals, sizeof(signals))) > 0)
     {
-        //数据头反序列化成功
-        service_name=rpcHeader.service_name();
-        method_name=rpcHeader.method_name();
-        args_size=rpcHeader.arg_size();
+        for (ssize_t i = 0; i < n; i++)
+        {
+            if (signals[i] == SIGUSR1)
+            {
+                //按需导出追踪记录
+                std::string path = MprpcApplication::GetInstance().GetConfig().Load("trace_dump_file");
+                if (path.empty())
+                {
+                    path = "rpc-trace-" + std::to_string(getpid()) + ".txt";
+                }
+                RpcTracer::GetInstance().DumpToFile(path);
+                uint64_t flushes=m_flushCount.load(std::memory_order_relaxed);
+                uint64_t responces=m_flushedResponces.load(std::memory_order_relaxed);
+                LOG_INFO("write combining: %lu responces in %lu flushes, %.2f responces per flush",
+                         responces,flushes,flushes==0 ? 0.0 : static_cast<double>(responces)/flushes);
+                LOG_INFO("response cache: %lu hits, %lu misses, %lu coalesced requests",
+                         m_cache.Hits(),m_cache.Misses(),m_singleflight.Coalesced());
+                LOG_INFO("rate limit: %lu throttled requests",m_rateLimiter.Throttled());
+            }
+            else if (signals[i] == SIGTERM || signals[i] == SIGINT)
+            {
+                if (m_draining)
+                {
+                    //下线过程中再次收到信号，不再等待直接退出
+                    LOG_INFO("second stop signal received, quit immediately");
+                    m_eventLoop.quit();
+                }
+                else
+                {
+                    StartDrain();
+                }
+            }
+        }
     }
-    else
+}
+
+void RpcProvider::StartDrain()
+{
+    m_draining = true;
+
+    MprpcConfig &config = MprpcApplication::GetInstance().GetConfig();
+    // drain_grace_ms：注销后继续服务的宽限期，要覆盖nginx配置更新和重载的时间，默认6秒
+    std::string grace_str = config.Load("drain_grace_ms");
+    int grace_ms = grace_str.empty() ? 6000 : atoi(grace_str.c_str());
+    // drain_timeout_ms：宽限期后等待处理中请求完成的最长时间，默认10秒
+    std::string timeout_str = config.Load("drain_timeout_ms");
+    int timeout_ms = timeout_str.empty() ? 10000 : atoi(timeout_str.c_str());
+    m_drainDeadline = RpcTracer::NowMicros() + static_cast<int64_t>(grace_ms + timeout_ms) * 1000;
+
+    LOG_INFO("start draining, grace:%dms timeout:%dms inflight:%d", grace_ms, timeout_ms, m_admission.InFlight());
+
+    //先注销实例节点，让nginx和调用方不再把新请求路由过来
+    {
+        std::lock_guard<std::mutex> lock(m_registerMutex);
+        for (const auto &sp : m_instancePaths)
+        {
+            for (const std::string &path : sp.second)
+            {
+                m_zkClient->Delete(path.c_str());
+            }
+        }
+        m_instancePaths.clear();
+    }
+
+    m_eventLoop.runAfter(grace_ms / 1000.0, std::bind(&RpcProvider::StopAcceptingRequests, this));
+}
+
+void RpcProvider::StopAcceptingRequests()
+{
+    //宽限期结束，之后到达的请求以可重试的状态拒绝
+    m_rejectNew = true;
+    LOG_INFO("grace period over, rejecting new requests, inflight:%d", m_admission.InFlight());
+    CheckDrained();
+}
+
+void RpcProvider::CheckDrained()
+{
+    int inflight = m_admission.InFlight();
+    if (inflight == 0 || RpcTracer::NowMicros() >= m_drainDeadline)
     {
-        //数据头反序列化失败
-        std::cout<<"rpc_header_str:"<<rpc_header_str<<"parse error!"<<std::endl;
+        LOG_INFO("drain finished, inflight:%d", inflight);
+        m_eventLoop.quit();
         return;
     }
+    m_eventLoop.runAfter(0.05, std::bind(&RpcProvider::CheckDrained, this));
+}
+
+//组装响应帧：4字节header长度 + RpcResponseHeader + 响应数据
+static std::string PackResponce(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+                                const std::string &body, mprpc::RpcFrameType frame_type=mprpc::FRAME_CALL,
+                                uint32_t window=0, mprpc::RpcCompression compression=mprpc::COMPRESS_NONE,
+                                uint32_t raw_size=0, uint32_t dict_id=0)
+{
+    mprpc::RpcResponseHeader header;
+    header.set_frame_type(frame_type);
+    header.set_window(window);
+    header.set_status(status);
+    header.set_error_text(error_text);
+    header.set_body_size(body.size());
+    header.set_request_id(request_id);
+    header.set_compression(compression);
+    header.set_raw_size(raw_size);
+    header.set_dict_id(dict_id);
+
+    std::string header_str=header.SerializeAsString();
+    uint32_t net_header_size=htonl(header_str.size());
+    std::string frame;
+    frame.reserve(4+header_str.size()+body.size());
+    frame.append(reinterpret_cast<const char*>(&net_header_size),4);
+    frame+=header_str;
+    frame+=body;
+    return frame;
+}
+
+//组装成功的响应帧，按协商后的策略压缩响应数据
+static std::string PackResponce(uint64_t request_id, const std::string &body, const RpcCompressPolicy &compress)
+{
+    std::string compressed;
+    if(RpcCompressor::Compress(compress,body.data(),body.size(),&compressed))
+    {
+        return PackResponce(request_id,mprpc::RPC_OK,"",compressed,mprpc::FRAME_CALL,0,compress.codec,body.size(),compress.dict_id);
+    }
+    return PackResponce(request_id,mprpc::RPC_OK,"",body);
+}
+
+void RpcProvider::OnMessage(const muduo::net::TcpConnectionPtr &conn, 
+                            muduo::net::Buffer *buffer, 
+                            muduo::Timestamp receiveTime)
+{
+    //一个连接上可以连续发送多个请求而不必等待响应，这里把缓冲区中所有完整的请求帧都取出来处理，
+    //不完整的帧留在缓冲区里等待后续数据
+    std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+    //背压期间已经读进来的请求也先不处理，等输出缓冲发送完再继续
+    while(!ctx->paused&&!m_handingOff&&buffer->readableBytes()>=4)
+    {
+        //从字符流读取前4个字节的内容，将网络字节序转换为主机字节序
+        uint32_t header_size=0;
+        uint32_t net_header_size = 0;
+        memcpy(&net_header_size, buffer->peek(), 4);
+        header_size = ntohl(net_header_size);
+        if(header_size>m_maxFrameBytes)
+        {
+            //长度不可信，不再等待后续数据，断开连接
+            LOG_ERR("rpc header too large! header_size:%u peer:%s",header_size,ctx->peer.c_str());
+            buffer->retrieveAll();
+            conn->shutdown();
+            break;
+        }
+        if(header_size>buffer->readableBytes()-4)
+        {
+            break;
+        }
+
+        //根据header_size读取数据头的原始字符流，反序列化数据，得到rpc请求的详细信息
+        mprpc::RpcHeader rpcHeader;
+        if(!rpcHeader.ParseFromArray(buffer->peek()+4,header_size))
+        {
+            //数据头反序列化失败，后面的数据已经无法分帧，断开连接
+            LOG_ERR("rpc header parse error! header_size:%u", header_size);
+            buffer->retrieveAll();
+            conn->shutdown();
+            break;
+        }
+        size_t frame_size=4+static_cast<size_t>(header_size)+rpcHeader.arg_size();
+        if(frame_size>m_maxFrameBytes)
+        {
+            LOG_ERR("rpc frame too large! frame_size:%lu peer:%s",frame_size,ctx->peer.c_str());
+            buffer->retrieveAll();
+            conn->shutdown();
+            break;
+        }
+        if(buffer->readableBytes()<frame_size)
+        {
+            break;
+        }
+
+        switch(rpcHeader.frame_type())
+        {
+        case mprpc::FRAME_CALL:
+            OnRequest(ctx,rpcHeader,header_size,buffer->peek()+4+header_size,receiveTime.microSecondsSinceEpoch());
+            break;
+        default:
+            OnStreamFrame(conn,rpcHeader,buffer->peek()+4+header_size);
+            break;
+        }
+        buffer->retrieve(frame_size);
+    }
+    UpdateBufferGauges(conn,ctx.get());
+}
+
+void RpcProvider::OnRequest(const std::shared_ptr<RpcResponder> &responder,
+                            const mprpc::RpcHeader &rpcHeader,
+                            uint32_t header_size,
+                            const char *args,
+                            int64_t receive_us)
+{
+    const std::string &service_name=rpcHeader.service_name();
+    const std::string &method_name=rpcHeader.method_name();
+    uint32_t args_size=rpcHeader.arg_size();
+    uint64_t request_id=rpcHeader.request_id();
+
+    bool sampled=RpcTracer::GetInstance().ShouldSample();
+    RpcTraceRecord trace;
+    if(sampled)
+    {
+        //记录采样信息，代替原来逐个请求的调试打印
+        trace.side='P';
+        trace.status=mprpc::RPC_OK;
+        trace.start_us=receive_us;
+        trace.cost_us=0;
+        trace.header_size=header_size;
+        trace.args_size=args_size;
+        trace.response_size=0;
+        trace.SetName(service_name,method_name);
+    }
 
-    //获取rpc方法参数的字符流数据
-    std::string args_str=recv_buf.substr(4+header_size,args_size);
+    //获取service对象和method对象，服务项由引用计数保持，服务注销后等这次调用结束才释放
+    std::shared_ptr<ServiceInfo> service_info=FindService(service_name);
+    if(!service_info){
+        LOG_ERR("%s is not exist!",service_name.c_str());
+        SendErrorResponce(responder,request_id,RpcMetrics::kUnknownMethod,mprpc::RPC_NOT_FOUND,service_name+" is not exist!",sampled ? &trace : nullptr);
+        return;
+    }
 
-    //打印调试信息
-    std::cout<<"============================="<<std::endl;
-    std::cout<<"head_size:"<<header_size<<std::endl;
-    std::cout<<"rpc_header_str:"<<rpc_header_str<<std::endl;
-    std::cout<<"service_name:"<<service_name<<std::endl;
-    std::cout<<"method_name:"<<method_name<<std::endl;
-    std::cout<<"args_size:"<<args_size<<std::endl;
-    std::cout<<"args_str:"<<args_str<<std::endl;
-    std::cout<<"============================="<<std::endl;
+    auto mit=service_info->m_methodMap.find(method_name);
+    if(mit==service_info->m_methodMap.end()){
+        LOG_ERR("%s:%s is not exist!",service_name.c_str(),method_name.c_str());
+        SendErrorResponce(responder,request_id,RpcMetrics::kUnknownMethod,mprpc::RPC_NOT_FOUND,service_name+":"+method_name+" is not exist!",sampled ? &trace : nullptr);
+        return;
+    }
+    uint32_t method_id=mit->second.m_id;
 
-    //获取service对象和method对象
-    auto it=m_serviceMap.find(service_name);
-    if(it==m_serviceMap.end()){
-        std::cout<<service_name<<"is not exist!"<<std::endl;
+    //正在下线，让调用方换一个节点重试
+    if(m_rejectNew)
+    {
+        SendErrorResponce(responder,request_id,method_id,mprpc::RPC_UNAVAILABLE,"server is shutting down",sampled ? &trace : nullptr);
         return;
     }
 
-    auto mit=it->second.m_methodMap.find(method_name);
-    if(mit==it->second.m_methodMap.end()){
-        std::cout<<service_name<<":"<<method_name<<"is not exist!"<<std::endl;
+    google::protobuf::Service *service=service_info->m_service;//获取service对象 new UserService
+    const google::protobuf::MethodDescriptor *method=mit->second.m_descriptor;//获取method对象 Login
+    RpcScheduler::MethodQueue *queue=mit->second.m_queue;
+    int64_t now_us=RpcTracer::NowMicros();
+
+    //限流：调用方没有带client_id时按连接的对端地址区分
+    const std::string &peer=rpcHeader.client_id().empty() ? responder->Peer() : rpcHeader.client_id();
+    if(!m_rateLimiter.Allow(peer,method_id,now_us))
+    {
+        SendErrorResponce(responder,request_id,method_id,mprpc::RPC_THROTTLED,"rate limit exceeded",sampled ? &trace : nullptr);
         return;
     }
 
-    google::protobuf::Service *service=it->second.m_service;//获取service对象 new UserService
-    const google::protobuf::MethodDescriptor *method=mit->second;//获取method对象 Login
+    //压缩的请求先解压到本线程的缓冲区，之后的缓存、合并和解析都使用解压后的参数，处理完这个请求时缓冲区过大就释放
+    std::unique_ptr<std::string,void(*)(std::string*)> raw_args_release(nullptr,&RpcCompressor::ReleaseBuffer);
+    if(rpcHeader.compression()!=mprpc::COMPRESS_NONE)
+    {
+        //没有调用方用的字典时返回可重试的状态，调用方不用字典重发
+        if(rpcHeader.dict_id()!=0&&!RpcCompressor::HasDictionary(rpcHeader.dict_id()))
+        {
+            SendErrorResponce(responder,request_id,method_id,mprpc::RPC_UNKNOWN_DICT,"unknown compression dictionary",sampled ? &trace : nullptr);
+            return;
+        }
+        thread_local std::string raw_args;
+        raw_args_release.reset(&raw_args);
+        if(!RpcCompressor::Decompress(rpcHeader.compression(),rpcHeader.dict_id(),args,args_size,rpcHeader.raw_size(),&raw_args))
+        {
+            SendErrorResponce(responder,request_id,method_id,mprpc::RPC_BAD_REQUEST,"request decompress error",sampled ? &trace : nullptr);
+            return;
+        }
+        args=raw_args.data();
+        args_size=raw_args.size();
+    }
+    RpcCompressPolicy compress=mit->second.m_compress.Negotiate(rpcHeader.accept_compression(),rpcHeader.accept_dict_id());
+
+    //响应缓存：命中时直接回复缓存的响应，不解析请求也不执行方法
+    std::string cache_key;
+    if(mit->second.m_cacheTtlUs>0)
+    {
+        cache_key=RpcResponseCache::MakeKey(method_id,args,args_size);
+        std::string responce_str;
+        if(m_cache.Lookup(cache_key,now_us,&responce_str))
+        {
+            responder->SendFrame(PackResponce(request_id,responce_str,compress));
+            m_metrics.Record(method_id,mprpc::RPC_OK,-1,0,args_size,responce_str.size());
+            if(sampled)
+            {
+                trace.cost_us=RpcTracer::NowMicros()-trace.start_us;
+                trace.response_size=responce_str.size();
+                RpcTracer::GetInstance().Record(trace);
+            }
+            return;
+        }
+    }
+
+    //合并执行：相同的请求正在执行时挂在它上面等结果，不再占用准入名额和执行线程
+    std::string flight_key;
+    if(mit->second.m_coalesce)
+    {
+        flight_key=cache_key.empty() ? RpcResponseCache::MakeKey(method_id,args,args_size) : cache_key;
+        bool leader=m_singleflight.Join(flight_key,
+            [this,responder,request_id,method_id,args_size,sampled,trace,compress](mprpc::RpcStatus status,const std::string &error_text,const std::string &body) mutable
+            {
+                responder->SendFrame(status==mprpc::RPC_OK ? PackResponce(request_id,body,compress) : PackResponce(request_id,status,error_text,body));
+                m_metrics.Record(method_id,status,-1,0,args_size,body.size());
+                if(sampled)
+                {
+                    trace.cost_us=RpcTracer::NowMicros()-trace.start_us;
+                    trace.response_size=body.size();
+                    trace.status=status;
+                    RpcTracer::GetInstance().Record(trace);
+                }
+            });
+        if(!leader)
+        {
+            return;
+        }
+    }
+
+    //准入控制：在解析请求参数之前就拒绝，过载时尽量少做无用功。
+    //有工作线程时这里只检查并发上限，CoDel只用工作线程出队时的排队延迟判断
+    bool admitted=m_scheduler.ThreadNum()>0 ? m_admission.TryAcquire()
+                                             : m_admission.Admit(now_us-receive_us,now_us,queue->priority);
+    if(!admitted)
+    {
+        SendErrorResponce(responder,request_id,method_id,mprpc::RPC_OVERLOADED,"server overloaded",sampled ? &trace : nullptr);
+        CompleteFlight(flight_key,mprpc::RPC_OVERLOADED,"server overloaded","");
+        return;
+    }
 
     //生成rpc方法调用的请求request和响应response参数
+    //请求直接从接收缓冲区中解析，解析完才从缓冲区取走这一帧
     google::protobuf::Message *request=service->GetRequestPrototype(method).New();
-    if(!request->ParseFromString(args_str))
+    std::unique_ptr<RpcAliasController> alias;
+    bool parsed;
+    if(mit->second.m_aliasBytes>0)
+    {
+        //交给工作线程执行时缓冲区在处理函数返回前就会被取走，这时先把参数整体复制一份再引用
+        alias.reset(new RpcAliasController);
+        parsed=alias->Parse(args,args_size,mit->second.m_aliasBytes,m_scheduler.ThreadNum()>0,request);
+    }
+    else
+    {
+        parsed=request->ParseFromArray(args,args_size);
+    }
+    if(!parsed)
     {
-        std::cout<<"request parse error,content:"<<args_str<<std::endl;
+        LOG_ERR("%s:%s request parse error! args_size:%u",service_name.c_str(),method_name.c_str(),args_size);
+        delete request;
+        m_admission.Release();
+        SendErrorResponce(responder,request_id,method_id,mprpc::RPC_BAD_REQUEST,"request parse error",sampled ? &trace : nullptr);
+        CompleteFlight(flight_key,mprpc::RPC_BAD_REQUEST,"request parse error","");
         return;
     }
     google::protobuf::Message *response=service->GetResponsePrototype(method).New();
 
+    RpcCall *call=new RpcCall;
+    call->responder=responder;
+    call->service=service;
+    call->owner=std::move(service_info);
+    call->method=method;
+    call->queue=queue;
+    call->method_id=method_id;
+    call->request_id=request_id;
+    call->receive_us=receive_us;
+    call->dispatch_us=0;
+    call->request_size=args_size;
+    call->request=request;
+    call->response=response;
+    call->sampled=sampled;
+    call->trace=trace;
+    call->cache_key.swap(cache_key);
+    call->cache_ttl_us=mit->second.m_cacheTtlUs;
+    call->flight_key.swap(flight_key);
+    call->alias=std::move(alias);
+    call->compress=compress;
+
+    if(method->server_streaming()||method->client_streaming())
+    {
+        //流的消息和流控帧只在muduo连接上收发，其他传输上的流式调用直接拒绝
+        std::shared_ptr<ConnContext> ctx=std::dynamic_pointer_cast<ConnContext>(responder);
+        muduo::net::TcpConnectionPtr conn=ctx ? ctx->conn.lock() : muduo::net::TcpConnectionPtr();
+        const char *error_text=nullptr;
+        mprpc::RpcStatus status=mprpc::RPC_INTERNAL;
+        if(!conn)
+        {
+            status=mprpc::RPC_BAD_REQUEST;
+            error_text="streaming method is not supported on this transport";
+        }
+        else if(m_scheduler.ThreadNum()==0)
+        {
+            //流式方法的处理函数会阻塞在等待配额上，只能放在工作线程中执行
+            error_text="streaming method requires rpc_worker_threads";
+        }
+        else
+        {
+            //每个流在整个流期间占用一个工作线程，限制同一方法同时进行的流数
+            int max_streams=mit->second.m_maxStreams>0 ? mit->second.m_maxStreams : std::max(1,m_scheduler.ThreadNum()/2);
+            if(m_activeStreams[method_id].fetch_add(1)>=max_streams)
+            {
+                m_activeStreams[method_id].fetch_sub(1);
+                status=mprpc::RPC_OVERLOADED;
+                error_text="too many streams";
+            }
+        }
+        if(error_text!=nullptr)
+        {
+            m_admission.Release();
+            SendErrorResponce(responder,request_id,method_id,status,error_text,sampled ? &trace : nullptr);
+            delete request;
+            delete response;
+            delete call;
+            return;
+        }
+        call->stream_conn=conn;
+        call->stream=CreateStream(conn,request_id,rpcHeader.window());
+    }
+
+    if(m_scheduler.ThreadNum()>0)
+    {
+        //交给工作线程按优先级和方法并发上限调度，io线程继续处理其他连接
+        m_scheduler.Submit(queue,[this,call]()
+        {
+            //出队时再检查一次排队延迟，在线程池里积压太久的请求直接拒绝
+            int64_t now_us=RpcTracer::NowMicros();
+            if(m_admission.Overloaded(now_us-call->receive_us,now_us,call->queue->priority))
+            {
+                m_scheduler.Finish(call->queue);
+                m_admission.Release();
+                SendErrorResponce(call->responder,call->request_id,call->method_id,mprpc::RPC_OVERLOADED,"server overloaded",call->sampled ? &call->trace : nullptr);
+                CompleteFlight(call->flight_key,mprpc::RPC_OVERLOADED,"server overloaded","");
+                if(call->stream)
+                {
+                    RemoveStream(call->stream_conn,call->request_id,call->stream.get(),call->method_id);
+                }
+                delete call->request;
+                delete call->response;
+                delete call;
+                return;
+            }
+            Dispatch(call);
+        });
+    }
+    else if(m_scheduler.TryAcquire(queue))
+    {
+        Dispatch(call);
+    }
+    else
+    {
+        //没有工作线程时无法排队，方法并发已满直接按过载拒绝
+        m_admission.Release();
+        SendErrorResponce(responder,request_id,method_id,mprpc::RPC_OVERLOADED,"method concurrency limit exceeded",sampled ? &trace : nullptr);
+        CompleteFlight(call->flight_key,mprpc::RPC_OVERLOADED,"method concurrency limit exceeded","");
+        delete request;
+        delete response;
+        delete call;
+    }
+}
+
+void RpcProvider::Dispatch(RpcCall *call)
+{
     //给下面的method方法的调用，绑定一个Closure的回调函数
-    google::protobuf::Closure *done=google::protobuf::NewCallback<RpcProvider,
-                            const muduo::net::TcpConnectionPtr &, google::protobuf::Message*>
-                            (this,&RpcProvider::SendRpcResponce,conn,response);     
+    google::protobuf::Closure *done=google::protobuf::NewCallback<RpcProvider,RpcCall*>
+                            (this,&RpcProvider::SendRpcResponce,call);
 
     //在框架上根据远端rpc请求，调用rpc节点上的发布的方法
     //new UserService().Login(method,nullptr,request,response)
-    service->CallMethod(method,nullptr,request,response,done);
+    call->dispatch_us=RpcTracer::NowMicros();
+    //流式方法把输出流作为controller传给处理函数，开启了引用解析的方法传RpcAliasController
+    google::protobuf::RpcController *controller=call->stream ? static_cast<google::protobuf::RpcController*>(call->stream.get()) : call->alias.get();
+    call->service->CallMethod(call->method,controller,call->request,call->response,done);
 }
 
-void RpcProvider::SendRpcResponce(const muduo::net::TcpConnectionPtr &conn, google::protobuf::Message* responce)
+void RpcProvider::SendRpcResponce(RpcCall* call)
 {
+    m_scheduler.Finish(call->queue);
+    m_admission.Release();
+
+    RpcResponder *responder=call->responder.get();
     std::string responce_str;
-    if(responce->SerializeToString(&responce_str))
+    size_t responce_size=0;
+    bool ok;
+    if(call->stream)
+    {
+        //服务端流的消息已经逐条发出，结束帧只带最终状态；只有调用方流时结束帧带上response
+        ok=!call->stream->Failed();
+        if(ok&&!call->method->server_streaming()&&!call->response->SerializeToString(&responce_str))
+        {
+            LOG_ERR("Serialize responce error!");
+            call->stream->SetFailed("serialize responce error");
+            ok=false;
+        }
+        responder->SendFrame(PackResponce(call->request_id,ok ? mprpc::RPC_OK : mprpc::RPC_INTERNAL,
+                                          call->stream->ErrorText(),ok ? responce_str : "",mprpc::FRAME_END));
+        RemoveStream(call->stream_conn,call->request_id,call->stream.get(),call->method_id);
+        responce_size=responce_str.size();
+    }
+    else if(call->cache_key.empty()&&call->flight_key.empty()&&call->compress.codec==mprpc::COMPRESS_NONE)
     {
-        //序列化成功，通过网络将rpc执行的结果返回调用方
-        conn->send(responce_str);
+        //不缓存、不合并也不压缩的响应直接序列化到传输的发送缓冲中
+        responder->Send(call->request_id,mprpc::RPC_OK,"",call->response);
+        ok=true;
+        responce_size=call->response->GetCachedSize();
+    }
+    else if((ok=call->response->SerializeToString(&responce_str)))
+    {
+        //序列化成功，通过网络将rpc执行的结果返回调用方，可缓存的方法同时写入缓存
+        if(!call->cache_key.empty())
+        {
+            m_cache.Insert(call->cache_key,responce_str,RpcTracer::NowMicros()+call->cache_ttl_us);
+        }
+        responder->SendFrame(PackResponce(call->request_id,responce_str,call->compress));
+        //先写缓存再结束合并，之后到达的相同请求会命中缓存
+        CompleteFlight(call->flight_key,mprpc::RPC_OK,"",responce_str);
+        responce_size=responce_str.size();
     }
     else
     {
-        std::cout<<"Serialize responce error!"<<std::endl;
+        LOG_ERR("Serialize responce error!");
+        responder->Send(call->request_id,mprpc::RPC_INTERNAL,"serialize responce error",nullptr);
+        CompleteFlight(call->flight_key,mprpc::RPC_INTERNAL,"serialize responce error","");
     }
-    conn->shutdown();
-}
\ No newline at end of file
+
+    int64_t now_us=RpcTracer::NowMicros();
+    m_metrics.Record(call->method_id,ok ? mprpc::RPC_OK : mprpc::RPC_INTERNAL,call->dispatch_us-call->receive_us,
+                     now_us-call->dispatch_us,call->request_size,responce_size);
+
+    if(call->sampled)
+    {
+        call->trace.cost_us=now_us-call->trace.start_us;
+        call->trace.response_size=responce_size;
+        call->trace.status=ok ? mprpc::RPC_OK : mprpc::RPC_INTERNAL;
+        RpcTracer::GetInstance().Record(call->trace);
+    }
+
+    delete call->request;
+    delete call->response;
+    delete call;
+}
+
+void RpcProvider::OnInlineRequest(const std::shared_ptr<RpcResponder> &responder, const char *frame, uint32_t len)
+{
+    //帧格式和TCP上的请求帧相同，传输只负责收发，之后和muduo连接上的请求经过同一条执行路径
+    int64_t receive_us=RpcTracer::NowMicros();
+    uint32_t header_size=0;
+    mprpc::RpcHeader rpcHeader;
+    if(len>=4)
+    {
+        memcpy(&header_size,frame,4);
+        header_size=ntohl(header_size);
+    }
+    if(len<4||header_size>len-4||!rpcHeader.ParseFromArray(frame+4,header_size)||rpcHeader.arg_size()!=len-4-header_size)
+    {
+        LOG_ERR("rpc header parse error! frame_size:%u",len);
+        responder->Send(rpcHeader.request_id(),mprpc::RPC_BAD_REQUEST,"rpc header parse error",nullptr);
+        return;
+    }
+    if(rpcHeader.frame_type()!=mprpc::FRAME_CALL)
+    {
+        //流式调用在建立时已经被拒绝，后续的流帧直接丢弃
+        return;
+    }
+    OnRequest(responder,rpcHeader,header_size,frame+4+header_size,receive_us);
+}
+
+void RpcProvider::SendErrorResponce(const std::shared_ptr<RpcResponder> &responder, uint64_t request_id, uint32_t method_id,
+                                    mprpc::RpcStatus status, const std::string &error_text, RpcTraceRecord *trace)
+{
+    responder->Send(request_id,status,error_text,nullptr);
+    m_metrics.Record(method_id,status,-1,0,0,0);
+
+    if(trace!=nullptr)
+    {
+        trace->cost_us=RpcTracer::NowMicros()-trace->start_us;
+        trace->status=status;
+        RpcTracer::GetInstance().Record(*trace);
+    }
+}
+
+void RpcProvider::CompleteFlight(const std::string &key, mprpc::RpcStatus status,
+                                 const std::string &error_text, const std::string &body)
+{
+    if(!key.empty())
+    {
+        m_singleflight.Complete(key,status,error_text,body);
+    }
+}
+
+std::shared_ptr<RpcServerStream> RpcProvider::CreateStream(const muduo::net::TcpConnectionPtr &conn,
+                                                           uint64_t request_id, uint32_t window)
+{
+    //流的消息和普通响应一样经过写合并发送
+    std::shared_ptr<RpcServerStream> stream=std::make_shared<RpcServerStream>(window,
+        [this,conn,request_id](const std::string &body)
+        {
+            QueueResponce(conn,PackResponce(request_id,mprpc::RPC_OK,"",body,mprpc::FRAME_MESSAGE));
+        },
+        [this,conn,request_id](uint32_t window)
+        {
+            QueueResponce(conn,PackResponce(request_id,mprpc::RPC_OK,"","",mprpc::FRAME_WINDOW,window));
+        });
+
+    std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+    ctx->streams[request_id]=stream;
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    m_streams.insert(stream.get());
+    return stream;
+}
+
+void RpcProvider::RemoveStream(const muduo::net::TcpConnectionPtr &conn, uint64_t request_id, RpcServerStream *stream,
+                               uint32_t method_id)
+{
+    m_activeStreams[method_id].fetch_sub(1);
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        m_streams.erase(stream);
+    }
+    //连接上的流表只在io线程中访问
+    conn->getLoop()->runInLoop([conn,request_id]()
+    {
+        std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+        ctx->streams.erase(request_id);
+    });
+}
+
+void RpcProvider::OnStreamFrame(const muduo::net::TcpConnectionPtr &conn, const mprpc::RpcHeader &rpcHeader, const char *data)
+{
+    std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+    auto it=ctx->streams.find(rpcHeader.request_id());
+    if(it==ctx->streams.end())
+    {
+        //流已经结束，晚到的帧直接丢弃
+        return;
+    }
+    RpcServerStream *stream=it->second.get();
+
+    switch(rpcHeader.frame_type())
+    {
+    case mprpc::FRAME_WINDOW:
+        stream->AddWindow(rpcHeader.window());
+        break;
+    case mprpc::FRAME_MESSAGE:
+        if(!stream->PushMessage(data,rpcHeader.arg_size()))
+        {
+            //调用方不遵守流控，取消这个流，处理函数的Read/Write会返回false
+            LOG_ERR("stream %lu exceeds flow control window, cancel it",rpcHeader.request_id());
+            stream->Cancel();
+        }
+        break;
+    case mprpc::FRAME_END:
+        stream->CloseRead();
+        break;
+    case mprpc::FRAME_CANCEL:
+        //调用方放弃了这个流，处理函数的Read/Write返回false后结束，结束帧照常发出
+        stream->Cancel();
+        break;
+    default:
+        LOG_ERR("unexpected frame type:%d request id:%lu",rpcHeader.frame_type(),rpcHeader.request_id());
+        break;
+    }
+}
+
+bool RpcProvider::ConnContext::Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+                                     const google::protobuf::Message *body)
+{
+    mprpc::RpcResponseHeader header;
+    std::string frame(PrepareFrame(&header,request_id,status,error_text,body),'\0');
+    WriteFrame(&frame[0],header,body);
+    return SendFrame(frame);
+}
+
+bool RpcProvider::ConnContext::SendFrame(const std::string &frame)
+{
+    muduo::net::TcpConnectionPtr connection=conn.lock();
+    if(!connection||!connection->connected())
+    {
+        return false;
+    }
+    provider->QueueResponce(connection,frame);
+    return true;
+}
+
+void RpcProvider::QueueResponce(const muduo::net::TcpConnectionPtr &conn, const std::string &frame)
+{
+    muduo::net::EventLoop *loop=conn->getLoop();
+    if(!loop->isInLoopThread())
+    {
+        //工作线程中完成的响应交给连接所属的io线程，由它统一合并发送
+        loop->runInLoop(std::bind(&RpcProvider::QueueResponce,this,conn,frame));
+        return;
+    }
+
+    std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+    ctx->pending.append(frame.data(),frame.size());
+    ctx->pending_count++;
+    if(!ctx->flush_queued)
+    {
+        //queueInLoop的回调在本轮事件处理完之后才执行，这期间完成的响应都会合并到同一次发送中
+        ctx->flush_queued=true;
+        loop->queueInLoop(std::bind(&RpcProvider::FlushResponces,this,conn));
+    }
+}
+
+void RpcProvider::FlushResponces(const muduo::net::TcpConnectionPtr &conn)
+{
+    std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+    m_flushCount.fetch_add(1,std::memory_order_relaxed);
+    m_flushedResponces.fetch_add(ctx->pending_count,std::memory_order_relaxed);
+    ctx->flush_queued=false;
+    ctx->pending_count=0;
+    //输出缓冲为空时muduo直接write一次，多个响应帧只产生一次系统调用
+    conn->send(&ctx->pending);
+    UpdateBufferGauges(conn,ctx.get());
+}
+
+void RpcProvider::OnHighWaterMark(const muduo::net::TcpConnectionPtr &conn, size_t len)
+{
+    std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+    if(ctx->paused||!conn->connected())
+    {
+        return;
+    }
+    //调用方读得太慢，停止读取它的请求，内核接收缓冲写满后由TCP流控把压力传回调用方
+    LOG_INFO("connection %s output buffer %lu bytes exceeds high water mark, stop reading",ctx->peer.c_str(),len);
+    ctx->paused=true;
+    conn->stopRead();
+    m_pausedConnections++;
+    m_backpressureEvents.fetch_add(1,std::memory_order_relaxed);
+    UpdateBufferGauges(conn,ctx.get());
+}
+
+void RpcProvider::OnWriteComplete(const muduo::net::TcpConnectionPtr &conn)
+{
+    std::shared_ptr<ConnContext> ctx=boost::any_cast<std::shared_ptr<ConnContext>>(conn->getContext());
+    if(ctx->paused&&!m_handingOff)
+    {
+        //输出缓冲已经全部发送，恢复读取，并处理暂停期间留在输入缓冲中的请求
+        ctx->paused=false;
+        m_pausedConnections--;
+        conn->startRead();
+        OnMessage(conn,conn->inputBuffer(),muduo::Timestamp::now());
+        return;
+    }
+    UpdateBufferGauges(conn,ctx.get());
+}
+
+void RpcProvider::UpdateBufferGauges(const muduo::net::TcpConnectionPtr &conn, ConnContext *ctx)
+{
+    size_t input=conn->inputBuffer()->readableBytes();
+    size_t output=conn->outputBuffer()->readableBytes()+ctx->pending.readableBytes();
+    m_inputBytes+=static_cast<int64_t>(input)-static_cast<int64_t>(ctx->input_bytes.exchange(input));
+    m_outputBytes+=static_cast<int64_t>(output)-static_cast<int64_t>(ctx->output_bytes.exchange(output));
+}
@@ -0,0 +1,135 @@
+#include "rpcratelimiter.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <cstdlib>
+#include <functional>
+
+void TokenBucket::Parameters(double qps, double burst, int64_t *interval_ns, int64_t *tolerance_ns)
+{
+    if (qps <= 0)
+    {
+        *interval_ns = 0;
+        *tolerance_ns = 0;
+        return;
+    }
+    if (burst < 1)
+    {
+        burst = qps < 1 ? 1 : qps;
+    }
+    *interval_ns = static_cast<int64_t>(1e9 / qps);
+    if (*interval_ns == 0)
+    {
+        *interval_ns = 1;
+    }
+    *tolerance_ns = static_cast<int64_t>((burst - 1) * *interval_ns);
+}
+
+void TokenBucket::SetRate(double qps, double burst)
+{
+    Parameters(qps, burst, &m_intervalNs, &m_toleranceNs);
+}
+
+bool TokenBucket::Acquire(std::atomic<int64_t> &tat, int64_t interval_ns, int64_t tolerance_ns, int64_t now_ns)
+{
+    if (interval_ns == 0)
+    {
+        return true;
+    }
+    int64_t old_tat = tat.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        // 空闲了一段时间的桶从当前时间重新开始，积攒的令牌不超过突发容量
+        int64_t start = old_tat > now_ns ? old_tat : now_ns;
+        if (start - now_ns > tolerance_ns)
+        {
+            return false;
+        }
+        if (tat.compare_exchange_weak(old_tat, start + interval_ns, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+}
+
+void TokenBucket::Release(std::atomic<int64_t> &tat, int64_t interval_ns)
+{
+    // 提前之后早于当前时间也没有关系，下次取令牌时会从当前时间重新开始
+    tat.fetch_sub(interval_ns, std::memory_order_relaxed);
+}
+
+RpcRateLimiter::RpcRateLimiter() : m_peerIntervalNs(0), m_peerToleranceNs(0), m_peerSlotCount(0)
+{
+    for (auto &m : m_methods)
+    {
+        m.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+RpcRateLimiter::~RpcRateLimiter()
+{
+    for (auto &m : m_methods)
+    {
+        delete m.load(std::memory_order_relaxed);
+    }
+}
+
+void RpcRateLimiter::Init()
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    double qps = atof(config.Load("rate_limit_peer_qps").c_str());
+    double burst = atof(config.Load("rate_limit_peer_burst").c_str());
+    TokenBucket::Parameters(qps, burst, &m_peerIntervalNs, &m_peerToleranceNs);
+    if (m_peerIntervalNs == 0)
+    {
+        return;
+    }
+
+    int slots = atoi(config.Load("rate_limit_peer_slots").c_str());
+    m_peerSlotCount = slots > 0 ? slots : 4096;
+    m_peerSlots.reset(new std::atomic<int64_t>[m_peerSlotCount]);
+    for (size_t i = 0; i < m_peerSlotCount; i++)
+    {
+        m_peerSlots[i].store(0, std::memory_order_relaxed);
+    }
+    LOG_INFO("peer rate limit qps:%g burst:%g slots:%lu", qps, burst, m_peerSlotCount);
+}
+
+void RpcRateLimiter::SetMethodLimit(uint32_t method_id, double qps, double burst)
+{
+    if (method_id >= kMaxMethods || qps <= 0)
+    {
+        return;
+    }
+    TokenBucket *bucket = new TokenBucket;
+    bucket->SetRate(qps, burst);
+    // 替换下来的旧桶可能还在被io线程使用，不释放；方法的限制只在注册时设置，泄漏的数量有限
+    m_methods[method_id].exchange(bucket, std::memory_order_acq_rel);
+}
+
+bool RpcRateLimiter::Allow(const std::string &peer, uint32_t method_id, int64_t now_us)
+{
+    int64_t now_ns = now_us * 1000;
+    std::atomic<int64_t> *slot = nullptr;
+    if (m_peerIntervalNs > 0)
+    {
+        slot = &m_peerSlots[std::hash<std::string>()(peer) % m_peerSlotCount];
+        if (!TokenBucket::Acquire(*slot, m_peerIntervalNs, m_peerToleranceNs, now_ns))
+        {
+            m_throttled.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    TokenBucket *bucket = method_id < kMaxMethods ? m_methods[method_id].load(std::memory_order_acquire) : nullptr;
+    if (bucket != nullptr && !bucket->Acquire(now_ns))
+    {
+        // 请求没有被放行，不能占用调用方的配额，否则被方法限流的请求会连带把调用方的其他方法也限住
+        if (slot != nullptr)
+        {
+            TokenBucket::Release(*slot, m_peerIntervalNs);
+        }
+        m_throttled.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,26 @@
+#include "rpcresponder.h"
+#include <cstring>
+#include <arpa/inet.h>
+
+uint32_t RpcResponder::PrepareFrame(mprpc::RpcResponseHeader *header, uint64_t request_id, mprpc::RpcStatus status,
+                                    const std::string &error_text, const google::protobuf::Message *body)
+{
+    header->set_frame_type(mprpc::FRAME_CALL);
+    header->set_status(status);
+    header->set_error_text(error_text);
+    header->set_body_size(body != nullptr ? body->ByteSizeLong() : 0);
+    header->set_request_id(request_id);
+    return 4 + header->ByteSizeLong() + header->body_size();
+}
+
+void RpcResponder::WriteFrame(char *out, const mprpc::RpcResponseHeader &header, const google::protobuf::Message *body)
+{
+    // 两者的大小在PrepareFrame中已经缓存，这里直接序列化到目标内存
+    uint32_t net_header_size = htonl(header.GetCachedSize());
+    memcpy(out, &net_header_size, 4);
+    uint8_t *p = header.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(out + 4));
+    if (body != nullptr)
+    {
+        body->SerializeWithCachedSizesToArray(p);
+    }
+}
@@ -0,0 +1,169 @@
+#include "rpcscheduler.h"
+#include "logger.h"
+#include <muduo/base/CountDownLatch.h>
+
+RpcPriority ParseRpcPriority(const std::string &name)
+{
+    if (name == "critical")
+    {
+        return RPC_PRIORITY_CRITICAL;
+    }
+    if (name == "sheddable")
+    {
+        return RPC_PRIORITY_SHEDDABLE;
+    }
+    return RPC_PRIORITY_DEFAULT;
+}
+
+const char *RpcPriorityName(RpcPriority priority)
+{
+    switch (priority)
+    {
+    case RPC_PRIORITY_CRITICAL:
+        return "critical";
+    case RPC_PRIORITY_SHEDDABLE:
+        return "sheddable";
+    default:
+        return "default";
+    }
+}
+
+RpcScheduler::~RpcScheduler()
+{
+    Stop();
+}
+
+RpcScheduler::MethodQueue *RpcScheduler::AddMethod(const std::string &name, int max_concurrency, RpcPriority priority)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    MethodQueue *mq = new MethodQueue;
+    mq->name = name;
+    mq->max_concurrency = max_concurrency;
+    mq->priority = priority;
+    mq->running = 0;
+    mq->ready = false;
+    m_methods.emplace_back(mq);
+    return mq;
+}
+
+void RpcScheduler::Start(int thread_num)
+{
+    muduo::CountDownLatch latch(thread_num);
+    for (int i = 0; i < thread_num; i++)
+    {
+        m_threads.emplace_back([this, &latch]() {
+            if (m_threadInitCallback)
+            {
+                m_threadInitCallback();
+            }
+            latch.countDown();
+            WorkerLoop();
+        });
+    }
+    latch.wait();
+    LOG_INFO("rpc scheduler started with %d worker threads", thread_num);
+}
+
+void RpcScheduler::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    for (std::thread &t : m_threads)
+    {
+        t.join();
+    }
+    m_threads.clear();
+}
+
+void RpcScheduler::MarkReady(MethodQueue *mq)
+{
+    if (!mq->ready && Runnable(mq))
+    {
+        mq->ready = true;
+        m_ready[mq->priority].push_back(mq);
+        m_cond.notify_one();
+    }
+}
+
+void RpcScheduler::Submit(MethodQueue *mq, Task task)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    mq->pending.push_back(std::move(task));
+    MarkReady(mq);
+}
+
+bool RpcScheduler::TryAcquire(MethodQueue *mq)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (mq->max_concurrency != 0 && mq->running >= mq->max_concurrency)
+    {
+        return false;
+    }
+    mq->running++;
+    return true;
+}
+
+void RpcScheduler::Finish(MethodQueue *mq)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    mq->running--;
+    // 归还名额后，之前因为并发已满而等待的请求可以重新参与调度
+    MarkReady(mq);
+}
+
+void RpcScheduler::Stats(int *running, size_t *queued)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    *running = 0;
+    *queued = 0;
+    for (const std::unique_ptr<MethodQueue> &mq : m_methods)
+    {
+        *running += mq->running;
+        *queued += mq->pending.size();
+    }
+}
+
+void RpcScheduler::WorkerLoop()
+{
+    for (;;)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            std::deque<MethodQueue *> *ready = nullptr;
+            for (;;)
+            {
+                for (int p = 0; p < RPC_PRIORITY_COUNT && ready == nullptr; p++)
+                {
+                    if (!m_ready[p].empty())
+                    {
+                        ready = &m_ready[p];
+                    }
+                }
+                if (ready != nullptr || m_stop)
+                {
+                    break;
+                }
+                m_cond.wait(lock);
+            }
+            if (ready == nullptr)
+            {
+                return;
+            }
+
+            // 取最高优先级中排在最前面的方法，执行它最早到达的请求
+            MethodQueue *mq = ready->front();
+            ready->pop_front();
+            mq->ready = false;
+            task = std::move(mq->pending.front());
+            mq->pending.pop_front();
+            mq->running++;
+            // 还有请求并且还有名额，排到同优先级队尾，让同级的方法轮流执行
+            MarkReady(mq);
+        }
+        task();
+    }
+}
@@ -0,0 +1,260 @@
+#include "rpcshmring.h"
+#include "rpctracer.h"
+#include <cstring>
+#include <thread>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+
+// 共享内存段的开头：魔数和队列容量，调用方映射时校验
+static const uint32_t kSegmentMagic = 0x6d707273; // "mprs"
+static const size_t kSegmentHeaderSize = 64;
+
+// 回绕标记：这条记录之后到队列末尾的空间都不使用
+static const uint32_t kWrapMarker = 0xFFFFFFFF;
+
+static inline void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+RpcShmRing::RpcShmRing() : m_header(nullptr), m_data(nullptr), m_capacity(0), m_eventFd(-1), m_pendingSkip(0), m_corrupted(false)
+{
+}
+
+void RpcShmRing::Attach(char *base, uint32_t capacity, int event_fd, bool init)
+{
+    m_header = reinterpret_cast<Header *>(base);
+    m_data = base + sizeof(Header);
+    m_capacity = capacity;
+    m_eventFd = event_fd;
+    if (init)
+    {
+        m_header->head.store(0, std::memory_order_relaxed);
+        m_header->tail.store(0, std::memory_order_relaxed);
+        m_header->waiting.store(0, std::memory_order_relaxed);
+        m_header->capacity = capacity;
+    }
+}
+
+char *RpcShmRing::Reserve(uint32_t len, int timeout_ms)
+{
+    if (len > MaxRecord())
+    {
+        return nullptr;
+    }
+    uint32_t need = Align(len);
+    uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+    uint32_t pos = tail & (m_capacity - 1);
+    uint32_t skip = need > m_capacity - pos ? m_capacity - pos : 0;
+
+    // 消费者释放空间时不发通知，队列满时让出cpu等待，正常情况下请求和响应一来一回，队列不会满
+    int64_t deadline_us = 0;
+    while (tail + skip + need - m_header->head.load(std::memory_order_acquire) > m_capacity)
+    {
+        int64_t now_us = RpcTracer::NowMicros();
+        if (deadline_us == 0)
+        {
+            deadline_us = now_us + static_cast<int64_t>(timeout_ms) * 1000;
+        }
+        else if (now_us >= deadline_us)
+        {
+            return nullptr;
+        }
+        std::this_thread::yield();
+    }
+
+    if (skip > 0)
+    {
+        memcpy(m_data + pos, &kWrapMarker, 4);
+    }
+    m_pendingSkip = skip;
+    return m_data + ((tail + skip) & (m_capacity - 1)) + 4;
+}
+
+void RpcShmRing::Commit(uint32_t len)
+{
+    uint64_t tail = m_header->tail.load(std::memory_order_relaxed) + m_pendingSkip;
+    memcpy(m_data + (tail & (m_capacity - 1)), &len, 4);
+    m_header->tail.store(tail + Align(len), std::memory_order_release);
+    m_pendingSkip = 0;
+
+    // 和消费者的Wait配对：先发布数据再检查标志，消费者先设置标志再检查数据，两边至少有一方看到对方
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_header->waiting.load(std::memory_order_relaxed) != 0)
+    {
+        uint64_t one = 1;
+        ssize_t n = write(m_eventFd, &one, sizeof(one));
+        (void)n;
+    }
+}
+
+bool RpcShmRing::Empty() const
+{
+    return m_header->head.load(std::memory_order_relaxed) == m_header->tail.load(std::memory_order_acquire);
+}
+
+const char *RpcShmRing::Peek(uint32_t *len)
+{
+    while (!m_corrupted)
+    {
+        uint64_t head = m_header->head.load(std::memory_order_relaxed);
+        uint64_t tail = m_header->tail.load(std::memory_order_acquire);
+        if (head == tail)
+        {
+            return nullptr;
+        }
+        // 生产者写的每条记录都完整地落在队列末尾之前，并且不超过已经提交的位置
+        uint32_t pos = head & (m_capacity - 1);
+        uint32_t record_len = 0;
+        memcpy(&record_len, m_data + pos, 4);
+        uint64_t record_end = head + (record_len != kWrapMarker ? Align(record_len) : m_capacity - pos);
+        if (tail - head > m_capacity || record_end > tail ||
+            (record_len != kWrapMarker && (record_len > MaxRecord() || pos + Align(record_len) > m_capacity)))
+        {
+            m_corrupted = true;
+            break;
+        }
+        if (record_len != kWrapMarker)
+        {
+            *len = record_len;
+            return m_data + pos + 4;
+        }
+        m_header->head.store(record_end, std::memory_order_release);
+    }
+    return nullptr;
+}
+
+void RpcShmRing::Consume(uint32_t len)
+{
+    m_header->head.store(m_header->head.load(std::memory_order_relaxed) + Align(len), std::memory_order_release);
+}
+
+bool RpcShmRing::Wait(int64_t spin_us, int timeout_ms)
+{
+    if (!Empty())
+    {
+        return true;
+    }
+    if (spin_us > 0)
+    {
+        int64_t deadline_us = RpcTracer::NowMicros() + spin_us;
+        do
+        {
+            for (int i = 0; i < 64; i++)
+            {
+                if (!Empty())
+                {
+                    return true;
+                }
+                CpuRelax();
+            }
+        } while (RpcTracer::NowMicros() < deadline_us);
+    }
+
+    m_header->waiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (Empty())
+    {
+        struct pollfd pfd;
+        pfd.fd = m_eventFd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, timeout_ms) > 0)
+        {
+            uint64_t count = 0;
+            ssize_t n = read(m_eventFd, &count, sizeof(count));
+            (void)n;
+        }
+    }
+    m_header->waiting.store(0, std::memory_order_relaxed);
+    return !Empty();
+}
+
+RpcShmSegment::RpcShmSegment()
+    : m_memFd(-1), m_requestEventFd(-1), m_responseEventFd(-1), m_base(nullptr), m_size(0)
+{
+}
+
+RpcShmSegment::~RpcShmSegment()
+{
+    if (m_base != nullptr)
+    {
+        munmap(m_base, m_size);
+    }
+    for (int fd : {m_memFd, m_requestEventFd, m_responseEventFd})
+    {
+        if (fd != -1)
+        {
+            close(fd);
+        }
+    }
+}
+
+bool RpcShmSegment::Map(uint32_t capacity, bool init)
+{
+    m_size = kSegmentHeaderSize + 2 * RpcShmRing::Size(capacity);
+    void *base = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_memFd, 0);
+    if (base == MAP_FAILED)
+    {
+        return false;
+    }
+    m_base = static_cast<char *>(base);
+    uint32_t *header = reinterpret_cast<uint32_t *>(m_base);
+    if (init)
+    {
+        header[0] = kSegmentMagic;
+        header[1] = capacity;
+    }
+    char *rings = m_base + kSegmentHeaderSize;
+    m_requests.Attach(rings, capacity, m_requestEventFd, init);
+    m_responses.Attach(rings + RpcShmRing::Size(capacity), capacity, m_responseEventFd, init);
+    return true;
+}
+
+bool RpcShmSegment::Create(uint32_t ring_bytes)
+{
+    uint32_t capacity = 4096;
+    while (capacity < ring_bytes && capacity < (1u << 30))
+    {
+        capacity <<= 1;
+    }
+    m_memFd = memfd_create("mprpc-shm", MFD_CLOEXEC);
+    m_requestEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    m_responseEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (m_memFd == -1 || m_requestEventFd == -1 || m_responseEventFd == -1)
+    {
+        return false;
+    }
+    if (ftruncate(m_memFd, kSegmentHeaderSize + 2 * RpcShmRing::Size(capacity)) == -1)
+    {
+        return false;
+    }
+    return Map(capacity, true);
+}
+
+bool RpcShmSegment::Attach(int mem_fd, int request_event_fd, int response_event_fd)
+{
+    m_memFd = mem_fd;
+    m_requestEventFd = request_event_fd;
+    m_responseEventFd = response_event_fd;
+    if (m_memFd == -1 || m_requestEventFd == -1 || m_responseEventFd == -1)
+    {
+        return false;
+    }
+
+    // 先读出头部的容量，再按容量映射整个段
+    uint32_t header[2] = {0, 0};
+    struct stat st;
+    if (pread(m_memFd, header, sizeof(header), 0) != sizeof(header) || header[0] != kSegmentMagic ||
+        header[1] < 4096 || (header[1] & (header[1] - 1)) != 0 || fstat(m_memFd, &st) == -1 ||
+        static_cast<size_t>(st.st_size) < kSegmentHeaderSize + 2 * RpcShmRing::Size(header[1]))
+    {
+        return false;
+    }
+    return Map(header[1], false);
+}
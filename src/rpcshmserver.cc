@@ -0,0 +1,213 @@
+#include "rpcshmserver.h"
+#include "rpchotrestart.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+RpcShmSession::RpcShmSession(int sock, std::unique_ptr<RpcShmSegment> segment)
+    : m_sock(sock), m_segment(std::move(segment))
+{
+}
+
+RpcShmSession::~RpcShmSession()
+{
+    close(m_sock);
+}
+
+bool RpcShmSession::Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+                         const google::protobuf::Message *body)
+{
+    mprpc::RpcResponseHeader header;
+    uint32_t len = PrepareFrame(&header, request_id, status, error_text, body);
+
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+    RpcShmRing &responses = m_segment->Responses();
+    char *frame = responses.Reserve(len, 1000);
+    if (frame == nullptr)
+    {
+        LOG_ERR("shm responce of %u bytes dropped, ring is full or record too large", len);
+        return false;
+    }
+    WriteFrame(frame, header, body);
+    responses.Commit(len);
+    return true;
+}
+
+bool RpcShmSession::SendFrame(const std::string &frame)
+{
+    std::lock_guard<std::mutex> lock(m_sendMutex);
+    RpcShmRing &responses = m_segment->Responses();
+    char *out = responses.Reserve(frame.size(), 1000);
+    if (out == nullptr)
+    {
+        LOG_ERR("shm responce of %lu bytes dropped, ring is full or record too large", frame.size());
+        return false;
+    }
+    memcpy(out, frame.data(), frame.size());
+    responses.Commit(frame.size());
+    return true;
+}
+
+RpcShmServer::RpcShmServer()
+    : m_pathInode(0), m_listenFd(-1), m_ringBytes(0), m_busyPollUs(0), m_maxSessions(0), m_stopped(false)
+{
+}
+
+RpcShmServer::~RpcShmServer()
+{
+    Stop();
+}
+
+bool RpcShmServer::Start(const RpcFrameCallback &callback)
+{
+    return Start(MprpcApplication::GetConfig().Load("rpc_shm_path"), callback);
+}
+
+bool RpcShmServer::Start(const std::string &path, const RpcFrameCallback &callback)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    int ring_kb = atoi(config.Load("rpc_shm_ring_kb").c_str());
+    m_ringBytes = (ring_kb > 0 ? ring_kb : 1024) * 1024;
+    m_busyPollUs = atoi(config.Load("rpc_shm_busy_poll_us").c_str());
+    int max_sessions = atoi(config.Load("rpc_shm_max_sessions").c_str());
+    m_maxSessions = max_sessions > 0 ? max_sessions : 64;
+
+    m_listenFd = RpcHotRestart::Listen(path);
+    if (m_listenFd == -1)
+    {
+        return false;
+    }
+    struct stat st;
+    m_pathInode = stat(path.c_str(), &st) == 0 ? st.st_ino : 0;
+    m_path = path;
+    m_callback = callback;
+    m_acceptThread = std::thread(&RpcShmServer::AcceptLoop, this);
+    LOG_INFO("shm transport listening on %s ring:%u busy_poll_us:%ld", path.c_str(), m_ringBytes, m_busyPollUs);
+    return true;
+}
+
+void RpcShmServer::Stop()
+{
+    if (m_listenFd == -1)
+    {
+        return;
+    }
+    m_stopped = true;
+    // 接受和会话线程每100毫秒检查一次停止标志
+    m_acceptThread.join();
+    for (auto &session : m_sessions)
+    {
+        session->thread.join();
+    }
+    m_sessions.clear();
+    close(m_listenFd);
+    m_listenFd = -1;
+    struct stat st;
+    if (stat(m_path.c_str(), &st) == 0 && st.st_ino == m_pathInode)
+    {
+        unlink(m_path.c_str());
+    }
+}
+
+void RpcShmServer::AcceptLoop()
+{
+    while (!m_stopped)
+    {
+        struct pollfd pfd;
+        pfd.fd = m_listenFd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        int ready = poll(&pfd, 1, 100);
+        ReapSessions();
+        if (ready <= 0)
+        {
+            continue;
+        }
+        int sock = accept4(m_listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (sock == -1)
+        {
+            continue;
+        }
+        if (m_sessions.size() >= m_maxSessions)
+        {
+            // 每个会话占用一个线程和两个方向的队列，达到上限时直接关闭，调用方建立会话失败
+            LOG_ERR("shm sessions reach the limit %lu, reject new session", m_maxSessions);
+            close(sock);
+            continue;
+        }
+
+        // 把共享内存和两个eventfd交给调用方，调用方映射之后会话即建立
+        std::unique_ptr<RpcShmSegment> segment(new RpcShmSegment);
+        if (!segment->Create(m_ringBytes) ||
+            !RpcHotRestart::Send(sock, RpcHotRestart::kShmSegment, "", segment->MemFd()) ||
+            !RpcHotRestart::Send(sock, RpcHotRestart::kShmEvent, "", segment->RequestEventFd()) ||
+            !RpcHotRestart::Send(sock, RpcHotRestart::kShmEvent, "", segment->ResponseEventFd()))
+        {
+            LOG_ERR("create shm session error! errno:%d", errno);
+            close(sock);
+            continue;
+        }
+        std::shared_ptr<RpcShmSession> session = std::make_shared<RpcShmSession>(sock, std::move(segment));
+        m_sessions.emplace_back(new SessionThread);
+        SessionThread *self = m_sessions.back().get();
+        self->thread = std::thread(&RpcShmServer::SessionLoop, this, session, self);
+        LOG_INFO("shm session established, sessions:%lu", m_sessions.size());
+    }
+}
+
+void RpcShmServer::ReapSessions()
+{
+    for (auto it = m_sessions.begin(); it != m_sessions.end();)
+    {
+        if ((*it)->finished.load(std::memory_order_acquire))
+        {
+            (*it)->thread.join();
+            it = m_sessions.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void RpcShmServer::SessionLoop(std::shared_ptr<RpcShmSession> session, SessionThread *self)
+{
+    RpcShmRing &requests = session->m_segment->Requests();
+    while (!m_stopped)
+    {
+        if (!requests.Wait(m_busyPollUs, 100))
+        {
+            // 空闲时检查调用方是否已经退出，调用方关闭socket后这里读到0
+            char c;
+            ssize_t n = recv(session->m_sock, &c, 1, MSG_DONTWAIT | MSG_PEEK);
+            if (n == 0 || (n == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            {
+                break;
+            }
+            continue;
+        }
+        uint32_t len = 0;
+        const char *frame = requests.Peek(&len);
+        if (frame != nullptr)
+        {
+            m_callback(session, frame, len);
+            requests.Consume(len);
+        }
+        else if (requests.Corrupted())
+        {
+            // 调用方写坏了请求队列，后面的数据已经无法分帧，结束会话，调用方看到socket关闭后重新建立
+            LOG_ERR("shm request ring corrupted, close session");
+            break;
+        }
+    }
+    // 释放会话的引用，异步完成的方法还持有会话时共享内存在它回复之后解除映射
+    session.reset();
+    LOG_INFO("shm session closed");
+    self->finished.store(true, std::memory_order_release);
+}
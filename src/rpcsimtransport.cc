@@ -0,0 +1,261 @@
+#include "rpcsimtransport.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <arpa/inet.h>
+
+static int64_t SteadyMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// 一帧从发出到对端可以读到所经过的时间
+static int64_t TransitMicros(size_t bytes)
+{
+    static const int64_t latency_us = atol(MprpcApplication::GetConfig().Load("rpc_sim_latency_us").c_str());
+    static const int64_t bandwidth_mbps = atol(MprpcApplication::GetConfig().Load("rpc_sim_bandwidth_mbps").c_str());
+    return latency_us + (bandwidth_mbps > 0 ? static_cast<int64_t>(bytes) * 8 / bandwidth_mbps : 0);
+}
+
+class SimPipe;
+
+struct SimFrame
+{
+    int64_t deliver_us;
+    std::string data;
+    std::shared_ptr<SimPipe> pipe; // 请求帧：回复响应的管道
+};
+
+// 一个方向上的帧队列，和TCP一样按发送顺序到达：一帧不会早于前一帧被读到
+class SimQueue
+{
+public:
+    SimQueue() : m_lastDeliverUs(0), m_closed(false) {}
+
+    bool Push(std::string data, std::shared_ptr<SimPipe> pipe)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed)
+        {
+            return false;
+        }
+        int64_t deliver_us = std::max(SteadyMicros() + TransitMicros(data.size()), m_lastDeliverUs);
+        m_lastDeliverUs = deliver_us;
+        m_frames.push_back(SimFrame{deliver_us, std::move(data), std::move(pipe)});
+        m_cond.notify_one();
+        return true;
+    }
+
+    // 等到队首的帧到达，timeout_ms内没有帧或者队列已关闭时返回false
+    bool Pop(SimFrame *frame, int timeout_ms)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (!m_closed)
+        {
+            if (m_frames.empty())
+            {
+                if (m_cond.wait_until(lock, deadline) == std::cv_status::timeout && m_frames.empty())
+                {
+                    return false;
+                }
+                continue;
+            }
+            int64_t wait_us = m_frames.front().deliver_us - SteadyMicros();
+            if (wait_us <= 0)
+            {
+                *frame = std::move(m_frames.front());
+                m_frames.pop_front();
+                return true;
+            }
+            m_cond.wait_for(lock, std::chrono::microseconds(wait_us));
+        }
+        return false;
+    }
+
+    void Close()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_frames.clear();
+        m_cond.notify_all();
+    }
+
+    bool Closed()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_closed;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<SimFrame> m_frames;
+    int64_t m_lastDeliverUs;
+    bool m_closed;
+};
+
+// 一条模拟连接上provider到调用方的方向，调用方断开后回复的响应被丢弃
+class SimPipe : public RpcResponder
+{
+public:
+    bool Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+              const google::protobuf::Message *body) override
+    {
+        mprpc::RpcResponseHeader header;
+        std::string frame(PrepareFrame(&header, request_id, status, error_text, body), '\0');
+        WriteFrame(&frame[0], header, body);
+        return responses.Push(std::move(frame), nullptr);
+    }
+    bool SendFrame(const std::string &frame) override
+    {
+        return responses.Push(frame, nullptr);
+    }
+    std::string Peer() const override { return "sim"; }
+
+    SimQueue responses;
+};
+
+struct RpcSimListener
+{
+    SimQueue requests;
+};
+
+// 模拟网络上登记的地址
+static std::mutex g_simMutex;
+static std::unordered_map<std::string, std::weak_ptr<RpcSimListener>> g_simListeners;
+
+RpcSimServerTransport::RpcSimServerTransport()
+{
+}
+
+RpcSimServerTransport::~RpcSimServerTransport()
+{
+    Stop();
+}
+
+bool RpcSimServerTransport::Start(const RpcFrameCallback &callback)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    std::string address = config.Load("rpcserverip") + ":" + config.Load("rpcserverport");
+    std::shared_ptr<RpcSimListener> listener = std::make_shared<RpcSimListener>();
+    {
+        std::lock_guard<std::mutex> lock(g_simMutex);
+        std::weak_ptr<RpcSimListener> &slot = g_simListeners[address];
+        if (!slot.expired())
+        {
+            LOG_ERR("sim address %s is already in use", address.c_str());
+            return false;
+        }
+        slot = listener;
+    }
+    m_address = address;
+    m_listener = listener;
+    m_thread = std::thread(&RpcSimServerTransport::Loop, this, callback);
+    LOG_INFO("sim transport listening on %s", address.c_str());
+    return true;
+}
+
+void RpcSimServerTransport::Stop()
+{
+    if (!m_listener)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_simMutex);
+        g_simListeners.erase(m_address);
+    }
+    m_listener->requests.Close();
+    m_thread.join();
+    m_listener.reset();
+}
+
+void RpcSimServerTransport::Loop(RpcFrameCallback callback)
+{
+    std::shared_ptr<RpcSimListener> listener = m_listener;
+    while (!listener->requests.Closed())
+    {
+        SimFrame frame;
+        if (listener->requests.Pop(&frame, 100))
+        {
+            callback(frame.pipe, frame.data.data(), frame.data.size());
+        }
+    }
+}
+
+class SimClientConnection : public RpcClientConnection
+{
+public:
+    explicit SimClientConnection(std::shared_ptr<RpcSimListener> listener)
+        : m_listener(std::move(listener)), m_pipe(std::make_shared<SimPipe>())
+    {
+    }
+
+    ~SimClientConnection() { m_pipe->responses.Close(); }
+
+    bool WriteFrame(const std::string &frame, google::protobuf::RpcController *controller) override
+    {
+        if (!m_listener->requests.Push(frame, m_pipe))
+        {
+            controller->SetFailed("sim connection reset!");
+            return false;
+        }
+        return true;
+    }
+
+    bool ReadFrame(mprpc::RpcResponseHeader *header, std::string *body,
+                   google::protobuf::RpcController *controller) override
+    {
+        SimFrame frame;
+        while (!m_pipe->responses.Pop(&frame, 100))
+        {
+            if (m_listener->requests.Closed())
+            {
+                controller->SetFailed("sim connection reset!");
+                return false;
+            }
+        }
+        uint32_t header_size = 0;
+        memcpy(&header_size, frame.data.data(), 4);
+        header_size = ntohl(header_size);
+        if (!header->ParseFromArray(frame.data.data() + 4, header_size))
+        {
+            controller->SetFailed("response header recv or parse error!");
+            return false;
+        }
+        body->assign(frame.data, 4 + header_size, std::string::npos);
+        return true;
+    }
+
+private:
+    std::shared_ptr<RpcSimListener> m_listener;
+    std::shared_ptr<SimPipe> m_pipe;
+};
+
+std::unique_ptr<RpcClientConnection> RpcSimClientTransport::Connect(const RpcEndpoint &endpoint,
+                                                                    google::protobuf::RpcController *controller)
+{
+    std::shared_ptr<RpcSimListener> listener;
+    {
+        std::lock_guard<std::mutex> lock(g_simMutex);
+        auto it = g_simListeners.find(endpoint.ip + ":" + std::to_string(endpoint.port));
+        if (it != g_simListeners.end())
+        {
+            listener = it->second.lock();
+        }
+    }
+    if (!listener)
+    {
+        controller->SetFailed("sim connect error! no provider at " + endpoint.ip + ":" + std::to_string(endpoint.port));
+        return nullptr;
+    }
+    return std::unique_ptr<RpcClientConnection>(new SimClientConnection(listener));
+}
@@ -0,0 +1,43 @@
+#include "rpcsingleflight.h"
+
+RpcSingleflight::Shard &RpcSingleflight::ShardOf(const std::string &key)
+{
+    return m_shards[std::hash<std::string>()(key) % kShardCount];
+}
+
+bool RpcSingleflight::Join(const std::string &key, const Waiter &waiter)
+{
+    Shard &shard = ShardOf(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.flights.find(key);
+    if (it == shard.flights.end())
+    {
+        shard.flights.emplace(key, std::vector<Waiter>());
+        return true;
+    }
+    it->second.push_back(waiter);
+    m_coalesced.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void RpcSingleflight::Complete(const std::string &key, mprpc::RpcStatus status,
+                               const std::string &error_text, const std::string &body)
+{
+    std::vector<Waiter> waiters;
+    {
+        Shard &shard = ShardOf(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.flights.find(key);
+        if (it == shard.flights.end())
+        {
+            return;
+        }
+        waiters.swap(it->second);
+        shard.flights.erase(it);
+    }
+    // 在锁外回调，回调中会把响应投递到各自连接的io线程
+    for (Waiter &waiter : waiters)
+    {
+        waiter(status, error_text, body);
+    }
+}
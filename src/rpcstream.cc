@@ -0,0 +1,122 @@
+#include "rpcstream.h"
+
+RpcServerStream::RpcServerStream(uint32_t window, const Sender &sender, const WindowSender &windowSender)
+    : m_sender(sender),
+      m_windowSender(windowSender),
+      m_window(window == 0 ? kDefaultStreamWindow : window),
+      m_recvWindow(kDefaultStreamWindow),
+      m_consumed(0),
+      m_readClosed(false),
+      m_canceled(false)
+{
+}
+
+RpcServerStream *RpcServerStream::FromController(google::protobuf::RpcController *controller)
+{
+    return dynamic_cast<RpcServerStream *>(controller);
+}
+
+bool RpcServerStream::Write(const google::protobuf::Message &message)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]() { return m_window > 0 || m_canceled; });
+        if (m_canceled)
+        {
+            return false;
+        }
+        m_window--;
+    }
+
+    std::string body;
+    if (!message.SerializeToString(&body))
+    {
+        SetFailed("serialize stream message error");
+        return false;
+    }
+    m_sender(body);
+    return true;
+}
+
+bool RpcServerStream::Read(google::protobuf::Message *message)
+{
+    std::string body;
+    uint32_t grant = 0;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [this]() { return !m_incoming.empty() || m_readClosed || m_canceled; });
+        if (m_canceled || m_incoming.empty())
+        {
+            return false;
+        }
+        body.swap(m_incoming.front());
+        m_incoming.pop_front();
+
+        // 处理完半个窗口的消息后把配额归还给调用方
+        if (++m_consumed >= kDefaultStreamWindow / 2)
+        {
+            grant = m_consumed;
+            m_recvWindow += grant;
+            m_consumed = 0;
+        }
+    }
+    if (grant > 0)
+    {
+        m_windowSender(grant);
+    }
+
+    if (!message->ParseFromString(body))
+    {
+        SetFailed("parse stream message error");
+        return false;
+    }
+    return true;
+}
+
+bool RpcServerStream::PushMessage(const char *data, size_t len)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_recvWindow == 0 || m_readClosed)
+        {
+            return false;
+        }
+        m_recvWindow--;
+        m_incoming.emplace_back(data, len);
+    }
+    m_cond.notify_all();
+    return true;
+}
+
+void RpcServerStream::CloseRead()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_readClosed = true;
+    }
+    m_cond.notify_all();
+}
+
+void RpcServerStream::AddWindow(uint32_t window)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_window += window;
+    }
+    m_cond.notify_all();
+}
+
+void RpcServerStream::Cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_canceled = true;
+    }
+    m_cond.notify_all();
+}
+
+bool RpcServerStream::IsCanceled() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_canceled;
+}
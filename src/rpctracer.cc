@@ -0,0 +1,118 @@
+#include "rpctracer.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+
+void RpcTraceRecord::SetName(const std::string &service, const std::string &method)
+{
+    snprintf(service_name, sizeof(service_name), "%s", service.c_str());
+    snprintf(method_name, sizeof(method_name), "%s", method.c_str());
+}
+
+RpcTracer &RpcTracer::GetInstance()
+{
+    static RpcTracer tracer;
+    return tracer;
+}
+
+RpcTracer::RpcTracer() : m_sampleInterval(0)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+
+    // trace_sample_rate取值0~1，例如0.01表示每100个请求采样一个，默认关闭
+    double rate = atof(config.Load("trace_sample_rate").c_str());
+    if (rate > 0)
+    {
+        m_sampleInterval = rate >= 1 ? 1 : static_cast<uint32_t>(1 / rate + 0.5);
+    }
+
+    // 缓冲区大小向上取整为2的幂，方便用掩码取下标
+    size_t size = atoi(config.Load("trace_buffer_size").c_str());
+    if (size == 0)
+    {
+        size = 4096;
+    }
+    size_t capacity = 1;
+    while (m_sampleInterval != 0 && capacity < size)
+    {
+        capacity <<= 1;
+    }
+    m_mask = capacity - 1;
+    m_slots = std::vector<Slot>(capacity);
+
+    LOG_INFO("rpc tracer sample interval:%u buffer size:%lu", m_sampleInterval, m_slots.size());
+}
+
+void RpcTracer::Record(const RpcTraceRecord &record)
+{
+    uint64_t idx = m_next.fetch_add(1, std::memory_order_relaxed);
+    Slot &slot = m_slots[idx & m_mask];
+
+    // 每个槽位是一个seqlock：先标记为写入中，写完后发布新的序号
+    slot.seq.store(idx * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = record;
+    slot.seq.store(idx * 2 + 2, std::memory_order_release);
+}
+
+size_t RpcTracer::Dump(FILE *pf)
+{
+    std::vector<std::pair<uint64_t, RpcTraceRecord>> records;
+    records.reserve(m_slots.size());
+    for (Slot &slot : m_slots)
+    {
+        uint64_t seq1 = slot.seq.load(std::memory_order_acquire);
+        if (seq1 == 0 || (seq1 & 1))
+        {
+            // 空槽位或者正在写入
+            continue;
+        }
+        RpcTraceRecord record = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t seq2 = slot.seq.load(std::memory_order_relaxed);
+        if (seq1 != seq2)
+        {
+            // 读取期间被覆盖，丢弃
+            continue;
+        }
+        records.push_back({seq1 / 2 - 1, record});
+    }
+
+    std::sort(records.begin(), records.end(),
+              [](const std::pair<uint64_t, RpcTraceRecord> &a, const std::pair<uint64_t, RpcTraceRecord> &b)
+              { return a.first < b.first; });
+
+    for (auto &r : records)
+    {
+        const RpcTraceRecord &rec = r.second;
+        fprintf(pf, "seq=%lu side=%c service=%s method=%s start_us=%ld cost_us=%ld header_size=%u args_size=%u response_size=%u status=%d\n",
+                r.first, rec.side, rec.service_name, rec.method_name,
+                rec.start_us, rec.cost_us, rec.header_size, rec.args_size, rec.response_size, rec.status);
+    }
+    fflush(pf);
+    return records.size();
+}
+
+size_t RpcTracer::DumpToFile(const std::string &path)
+{
+    FILE *pf = fopen(path.c_str(), "w");
+    if (pf == nullptr)
+    {
+        LOG_ERR("open trace dump file %s error!", path.c_str());
+        return 0;
+    }
+    size_t count = Dump(pf);
+    fclose(pf);
+    LOG_INFO("dump %lu trace records to %s", count, path.c_str());
+    return count;
+}
+
+int64_t RpcTracer::NowMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
@@ -0,0 +1,55 @@
+#include "rpctransport.h"
+#include "rpcclienttransport.h"
+#include "rpcshmserver.h"
+#ifdef MPRPC_WITH_URING
+#include "rpcuringserver.h"
+#endif
+#include "rpcsimtransport.h"
+
+RpcTransportRegistry &RpcTransportRegistry::GetInstance()
+{
+    static RpcTransportRegistry registry;
+    return registry;
+}
+
+RpcTransportRegistry::RpcTransportRegistry()
+{
+    m_servers["shm"] = []() { return std::unique_ptr<RpcServerTransport>(new RpcShmServer); };
+#ifdef MPRPC_WITH_URING
+    m_servers["uring"] = []() { return std::unique_ptr<RpcServerTransport>(new RpcUringServer); };
+#endif
+    m_servers["sim"] = []() { return std::unique_ptr<RpcServerTransport>(new RpcSimServerTransport); };
+
+    m_clients["tcp"] = std::make_shared<RpcTcpClientTransport>();
+#ifdef MPRPC_WITH_URING
+    m_clients["uring"] = std::make_shared<RpcUringClientTransport>();
+#endif
+    m_clients["shm"] = std::make_shared<RpcShmClientTransport>();
+    m_clients["sim"] = std::make_shared<RpcSimClientTransport>();
+}
+
+void RpcTransportRegistry::RegisterServer(const std::string &name, const ServerFactory &factory)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_servers[name] = factory;
+}
+
+void RpcTransportRegistry::RegisterClient(const std::string &name, const std::shared_ptr<RpcClientTransport> &transport)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_clients[name] = transport;
+}
+
+std::unique_ptr<RpcServerTransport> RpcTransportRegistry::CreateServer(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_servers.find(name);
+    return it != m_servers.end() ? it->second() : nullptr;
+}
+
+std::shared_ptr<RpcClientTransport> RpcTransportRegistry::GetClient(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_clients.find(name);
+    return it != m_clients.end() ? it->second : nullptr;
+}
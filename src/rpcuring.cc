@@ -0,0 +1,221 @@
+#include "rpcuring.h"
+#include "logger.h"
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// 环的第i项。不用io_uring_buf_ring::bufs：C++中内核头文件的柔性数组前面多了一个占1字节的空结构体，偏移是错的
+static inline struct io_uring_buf *BufferEntry(struct io_uring_buf_ring *ring, unsigned i)
+{
+    return reinterpret_cast<struct io_uring_buf *>(ring) + i;
+}
+
+template <typename T>
+static inline T LoadAcquire(const T *p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+template <typename T>
+static inline void StoreRelease(T *p, T value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+RpcUring::RpcUring()
+    : m_fd(-1), m_flags(0), m_sqRing(MAP_FAILED), m_sqRingSize(0), m_cqRing(MAP_FAILED), m_cqRingSize(0),
+      m_sqes(static_cast<struct io_uring_sqe *>(MAP_FAILED)), m_sqesSize(0), m_sqHead(nullptr), m_sqTail(nullptr),
+      m_sqMask(0), m_sqEntries(0), m_sqLocalTail(0), m_cqHead(nullptr), m_cqTail(nullptr), m_cqMask(0), m_cqes(nullptr),
+      m_bufRing(nullptr), m_bufRingSize(0), m_bufBase(nullptr), m_bufCount(0), m_bufSize(0)
+{
+}
+
+RpcUring::~RpcUring()
+{
+    if (m_bufRing != nullptr)
+    {
+        munmap(m_bufRing, m_bufRingSize);
+        delete[] m_bufBase;
+    }
+    if (m_sqes != MAP_FAILED)
+    {
+        munmap(m_sqes, m_sqesSize);
+    }
+    if (m_cqRing != MAP_FAILED && m_cqRing != m_sqRing)
+    {
+        munmap(m_cqRing, m_cqRingSize);
+    }
+    if (m_sqRing != MAP_FAILED)
+    {
+        munmap(m_sqRing, m_sqRingSize);
+    }
+    if (m_fd != -1)
+    {
+        close(m_fd);
+    }
+}
+
+bool RpcUring::Init(unsigned entries)
+{
+    // 完成项只在本线程进入内核时处理，省去内核异步通知的开销；老内核不支持时退回默认模式
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN;
+    m_fd = syscall(__NR_io_uring_setup, entries, &params);
+    if (m_fd == -1 && errno == EINVAL)
+    {
+        memset(&params, 0, sizeof(params));
+        m_fd = syscall(__NR_io_uring_setup, entries, &params);
+    }
+    if (m_fd == -1)
+    {
+        LOG_ERR("io_uring_setup error! errno:%d", errno);
+        return false;
+    }
+    m_flags = params.flags;
+
+    m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap && m_cqRingSize > m_sqRingSize)
+    {
+        m_sqRingSize = m_cqRingSize;
+    }
+    m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+    if (m_sqRing == MAP_FAILED)
+    {
+        return false;
+    }
+    m_cqRing = single_mmap ? m_sqRing
+                           : mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+    if (m_cqRing == MAP_FAILED)
+    {
+        return false;
+    }
+    m_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    m_sqes = static_cast<struct io_uring_sqe *>(
+        mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES));
+    if (m_sqes == MAP_FAILED)
+    {
+        return false;
+    }
+
+    char *sq = static_cast<char *>(m_sqRing);
+    m_sqHead = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    m_sqTail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    m_sqMask = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    m_sqEntries = params.sq_entries;
+    m_sqLocalTail = *m_sqTail;
+    // 提交项和队列下标一一对应，之后只需要推进尾部
+    unsigned *array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    for (unsigned i = 0; i < m_sqEntries; i++)
+    {
+        array[i] = i;
+    }
+
+    char *cq = static_cast<char *>(m_cqRing);
+    m_cqHead = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    m_cqTail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    m_cqMask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    m_cqes = reinterpret_cast<struct io_uring_cqe *>(cq + params.cq_off.cqes);
+    return true;
+}
+
+struct io_uring_sqe *RpcUring::GetSqe()
+{
+    if (m_sqLocalTail - LoadAcquire(m_sqHead) >= m_sqEntries)
+    {
+        return nullptr;
+    }
+    struct io_uring_sqe *sqe = &m_sqes[m_sqLocalTail & m_sqMask];
+    m_sqLocalTail++;
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+int RpcUring::Submit(unsigned wait_nr)
+{
+    unsigned to_submit = m_sqLocalTail - *m_sqTail;
+    StoreRelease(m_sqTail, m_sqLocalTail);
+    // DEFER_TASKRUN模式下只有带GETEVENTS进入内核时才会产生完成项
+    unsigned flags = (wait_nr > 0 || (m_flags & IORING_SETUP_DEFER_TASKRUN)) ? IORING_ENTER_GETEVENTS : 0;
+    int ret = syscall(__NR_io_uring_enter, m_fd, to_submit, wait_nr, flags, nullptr, 0);
+    if (ret == -1)
+    {
+        return errno == EINTR ? 0 : -errno;
+    }
+    return ret;
+}
+
+struct io_uring_cqe *RpcUring::PeekCqe()
+{
+    unsigned head = *m_cqHead;
+    if (head == LoadAcquire(m_cqTail))
+    {
+        return nullptr;
+    }
+    return &m_cqes[head & m_cqMask];
+}
+
+void RpcUring::SeenCqe()
+{
+    StoreRelease(m_cqHead, *m_cqHead + 1);
+}
+
+bool RpcUring::RegisterBuffers(const struct iovec *iovecs, unsigned count)
+{
+    if (syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_BUFFERS, iovecs, count) == -1)
+    {
+        LOG_ERR("io_uring register buffers error! errno:%d", errno);
+        return false;
+    }
+    return true;
+}
+
+bool RpcUring::SetupBufferRing(uint16_t group, unsigned count, unsigned size)
+{
+    m_bufRingSize = count * sizeof(struct io_uring_buf);
+    void *ring = mmap(nullptr, m_bufRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED)
+    {
+        return false;
+    }
+    struct io_uring_buf_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = reinterpret_cast<uint64_t>(ring);
+    reg.ring_entries = count;
+    reg.bgid = group;
+    if (syscall(__NR_io_uring_register, m_fd, IORING_REGISTER_PBUF_RING, &reg, 1) == -1)
+    {
+        LOG_ERR("io_uring register buffer ring error! errno:%d", errno);
+        munmap(ring, m_bufRingSize);
+        return false;
+    }
+
+    m_bufRing = static_cast<struct io_uring_buf_ring *>(ring);
+    m_bufCount = count;
+    m_bufSize = size;
+    m_bufBase = new char[static_cast<size_t>(count) * size];
+    for (unsigned i = 0; i < count; i++)
+    {
+        struct io_uring_buf *buf = BufferEntry(m_bufRing, i);
+        buf->addr = reinterpret_cast<uint64_t>(Buffer(i));
+        buf->len = size;
+        buf->bid = i;
+    }
+    StoreRelease(&m_bufRing->tail, static_cast<uint16_t>(count));
+    return true;
+}
+
+void RpcUring::RecycleBuffer(uint16_t id)
+{
+    uint16_t tail = m_bufRing->tail;
+    struct io_uring_buf *buf = BufferEntry(m_bufRing, tail & (m_bufCount - 1));
+    buf->addr = reinterpret_cast<uint64_t>(Buffer(id));
+    buf->len = m_bufSize;
+    buf->bid = id;
+    StoreRelease(&m_bufRing->tail, static_cast<uint16_t>(tail + 1));
+}
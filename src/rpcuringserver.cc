@@ -0,0 +1,608 @@
+#include "rpcuringserver.h"
+#include "rpcuring.h"
+#include "mprpcapplication.h"
+#include "logger.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// 完成项的user_data：高位为fd，低8位为操作类型。连接在没有进行中的操作之后才关闭fd，不会收到属于旧连接的完成项
+enum UringOp : uint64_t
+{
+    kUringAccept = 1,
+    kUringRecv = 2,
+    kUringSend = 3,
+    kUringWake = 4,
+};
+
+static inline uint64_t UserData(int fd, UringOp op)
+{
+    return (static_cast<uint64_t>(fd) << 8) | op;
+}
+
+// 接收缓冲区环的编号，每个io_uring只有一组
+static const uint16_t kBufferGroup = 0;
+
+// io_uring上的一个连接。input/sending等只在io线程中访问，output由m_mutex保护，任意线程都可以回复响应
+class RpcUringServer::Connection : public RpcResponder, public std::enable_shared_from_this<RpcUringServer::Connection>
+{
+public:
+    Connection(Worker *worker, int fd, const std::string &peer)
+        : fd(fd), sent(0), recv_armed(false), send_in_flight(false), m_worker(worker), m_peer(peer),
+          m_flushQueued(false), m_closed(false)
+    {
+    }
+
+    bool Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+              const google::protobuf::Message *body) override;
+    bool SendFrame(const std::string &frame) override;
+    std::string Peer() const override { return m_peer; }
+
+    // io线程：取出待发送的数据，没有数据时返回false
+    bool TakeOutput()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_flushQueued = false;
+        if (m_output.empty())
+        {
+            return false;
+        }
+        sending.swap(m_output);
+        m_output.clear();
+        return true;
+    }
+
+    void MarkClosed()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_output.clear();
+    }
+
+    int fd;
+    std::string input;   // 收到但还不是完整帧的数据
+    std::string sending; // 正在发送的数据
+    size_t sent;
+    bool recv_armed;     // multishot recv仍然有效
+    bool send_in_flight;
+
+private:
+    Worker *m_worker;
+    std::string m_peer;
+    std::mutex m_mutex;
+    std::string m_output; // 已经完成、等待发送的响应帧
+    bool m_flushQueued;
+    bool m_closed;
+};
+
+// 一个io线程：一个io_uring，一个监听socket和它接受的所有连接
+class RpcUringServer::Worker
+{
+public:
+    Worker(int listen_fd, size_t max_frame_bytes, const RpcFrameCallback &callback)
+        : m_listenFd(listen_fd), m_wakeFd(eventfd(0, EFD_CLOEXEC)), m_wakeValue(0), m_maxFrameBytes(max_frame_bytes),
+          m_callback(callback), m_stopped(false), m_connections(0)
+    {
+    }
+
+    ~Worker()
+    {
+        close(m_listenFd);
+        close(m_wakeFd);
+    }
+
+    bool Start(unsigned entries, unsigned buffers, unsigned buffer_size)
+    {
+        // io_uring由使用它的线程创建，提交和完成都只在这个线程中进行
+        std::promise<bool> started;
+        std::future<bool> result = started.get_future();
+        m_thread = std::thread(&Worker::Loop, this, entries, buffers, buffer_size, &started);
+        if (!result.get())
+        {
+            m_thread.join();
+            return false;
+        }
+        return true;
+    }
+
+    void Stop()
+    {
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+        m_stopped = true;
+        Wake();
+        m_thread.join();
+    }
+
+    // 连接有新的响应需要发送，其他线程调用时唤醒io线程
+    void QueueFlush(const std::shared_ptr<Connection> &conn)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_flushMutex);
+            m_flushQueue.push_back(conn);
+        }
+        if (std::this_thread::get_id() != m_threadId)
+        {
+            Wake();
+        }
+    }
+
+    int Connections() const { return m_connections.load(std::memory_order_relaxed); }
+
+private:
+    void Wake()
+    {
+        uint64_t one = 1;
+        ssize_t n = write(m_wakeFd, &one, sizeof(one));
+        (void)n;
+    }
+
+    void Loop(unsigned entries, unsigned buffers, unsigned buffer_size, std::promise<bool> *started)
+    {
+        m_threadId = std::this_thread::get_id();
+        if (m_wakeFd == -1 || !m_ring.Init(entries) || !m_ring.SetupBufferRing(kBufferGroup, buffers, buffer_size))
+        {
+            started->set_value(false);
+            return;
+        }
+        ArmAccept();
+        ArmWake();
+        started->set_value(true);
+
+        while (!m_stopped)
+        {
+            FlushQueued();
+            // 本轮产生的所有提交项一次提交，同时等待下一个完成项
+            int ret = m_ring.Submit(1);
+            if (ret < 0 && ret != -EAGAIN && ret != -EBUSY)
+            {
+                LOG_ERR("io_uring_enter error! errno:%d", -ret);
+                break;
+            }
+            struct io_uring_cqe *cqe;
+            while ((cqe = m_ring.PeekCqe()) != nullptr)
+            {
+                struct io_uring_cqe completion = *cqe;
+                m_ring.SeenCqe();
+                Handle(completion);
+            }
+        }
+
+        for (auto &cp : m_conns)
+        {
+            cp.second->MarkClosed();
+            close(cp.first);
+        }
+        m_conns.clear();
+        m_connections = 0;
+    }
+
+    struct io_uring_sqe *Sqe()
+    {
+        struct io_uring_sqe *sqe = m_ring.GetSqe();
+        while (sqe == nullptr)
+        {
+            // 提交队列满了先提交一批
+            m_ring.Submit(0);
+            sqe = m_ring.GetSqe();
+        }
+        return sqe;
+    }
+
+    void ArmAccept()
+    {
+        struct io_uring_sqe *sqe = Sqe();
+        sqe->opcode = IORING_OP_ACCEPT;
+        sqe->fd = m_listenFd;
+        sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+        sqe->accept_flags = SOCK_CLOEXEC;
+        sqe->user_data = UserData(m_listenFd, kUringAccept);
+    }
+
+    void ArmWake()
+    {
+        struct io_uring_sqe *sqe = Sqe();
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = m_wakeFd;
+        sqe->addr = reinterpret_cast<uint64_t>(&m_wakeValue);
+        sqe->len = sizeof(m_wakeValue);
+        sqe->off = static_cast<uint64_t>(-1);
+        sqe->user_data = UserData(m_wakeFd, kUringWake);
+    }
+
+    void ArmRecv(Connection *conn)
+    {
+        struct io_uring_sqe *sqe = Sqe();
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = conn->fd;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = kBufferGroup;
+        sqe->user_data = UserData(conn->fd, kUringRecv);
+        conn->recv_armed = true;
+    }
+
+    void ArmSend(Connection *conn)
+    {
+        struct io_uring_sqe *sqe = Sqe();
+        sqe->opcode = IORING_OP_SEND;
+        sqe->fd = conn->fd;
+        sqe->addr = reinterpret_cast<uint64_t>(conn->sending.data() + conn->sent);
+        sqe->len = conn->sending.size() - conn->sent;
+        sqe->msg_flags = MSG_NOSIGNAL;
+        sqe->user_data = UserData(conn->fd, kUringSend);
+    }
+
+    void StartSend(Connection *conn)
+    {
+        if (conn->send_in_flight || !conn->TakeOutput())
+        {
+            return;
+        }
+        conn->sent = 0;
+        conn->send_in_flight = true;
+        ArmSend(conn);
+    }
+
+    void FlushQueued()
+    {
+        std::vector<std::shared_ptr<Connection>> queue;
+        {
+            std::lock_guard<std::mutex> lock(m_flushMutex);
+            queue.swap(m_flushQueue);
+        }
+        for (const std::shared_ptr<Connection> &conn : queue)
+        {
+            if (m_conns.count(conn->fd) > 0 && m_conns[conn->fd] == conn)
+            {
+                StartSend(conn.get());
+            }
+        }
+    }
+
+    // recv已经结束并且没有进行中的发送时才关闭fd
+    void MaybeRelease(const std::shared_ptr<Connection> &conn)
+    {
+        if (conn->recv_armed || conn->send_in_flight)
+        {
+            return;
+        }
+        conn->MarkClosed();
+        close(conn->fd);
+        m_conns.erase(conn->fd);
+        m_connections.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void Handle(const struct io_uring_cqe &cqe)
+    {
+        int fd = static_cast<int>(cqe.user_data >> 8);
+        switch (cqe.user_data & 0xff)
+        {
+        case kUringAccept:
+            OnAccept(cqe.res, cqe.flags);
+            break;
+        case kUringWake:
+            ArmWake();
+            break;
+        case kUringRecv:
+            OnRecv(fd, cqe.res, cqe.flags);
+            break;
+        case kUringSend:
+            OnSend(fd, cqe.res);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void OnAccept(int res, uint32_t flags)
+    {
+        if (res >= 0)
+        {
+            int one = 1;
+            setsockopt(res, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            struct sockaddr_in peer;
+            socklen_t len = sizeof(peer);
+            char ip[INET_ADDRSTRLEN] = {0};
+            if (getpeername(res, reinterpret_cast<struct sockaddr *>(&peer), &len) == 0)
+            {
+                inet_ntop(AF_INET, &peer.sin_addr, ip, sizeof(ip));
+            }
+            std::shared_ptr<Connection> conn = std::make_shared<Connection>(this, res, ip);
+            m_conns[res] = conn;
+            m_connections.fetch_add(1, std::memory_order_relaxed);
+            ArmRecv(conn.get());
+        }
+        else if (res != -EAGAIN && res != -EINTR)
+        {
+            LOG_ERR("io_uring accept error! errno:%d", -res);
+        }
+        if (!(flags & IORING_CQE_F_MORE) && !m_stopped)
+        {
+            ArmAccept();
+        }
+    }
+
+    void OnRecv(int fd, int res, uint32_t flags)
+    {
+        auto it = m_conns.find(fd);
+        if (res > 0)
+        {
+            uint16_t id = flags >> IORING_CQE_BUFFER_SHIFT;
+            if (it != m_conns.end())
+            {
+                it->second->input.append(m_ring.Buffer(id), res);
+            }
+            m_ring.RecycleBuffer(id);
+        }
+        if (it == m_conns.end())
+        {
+            return;
+        }
+        std::shared_ptr<Connection> conn = it->second;
+        if (res > 0)
+        {
+            ProcessInput(conn);
+            if (!(flags & IORING_CQE_F_MORE))
+            {
+                ArmRecv(conn.get());
+            }
+            return;
+        }
+        if (res == -ENOBUFS)
+        {
+            // 接收缓冲区暂时用完，处理完其他完成项归还之后再接收
+            ArmRecv(conn.get());
+            return;
+        }
+        // 对端关闭或出错
+        conn->recv_armed = false;
+        MaybeRelease(conn);
+    }
+
+    void ProcessInput(const std::shared_ptr<Connection> &conn)
+    {
+        std::string &input = conn->input;
+        size_t offset = 0;
+        while (input.size() - offset >= 4)
+        {
+            uint32_t header_size = 0;
+            memcpy(&header_size, input.data() + offset, 4);
+            header_size = ntohl(header_size);
+            if (header_size > m_maxFrameBytes)
+            {
+                // 长度不可信，不再缓存后续数据，断开连接
+                LOG_ERR("rpc header too large! header_size:%u peer:%s", header_size, conn->Peer().c_str());
+                Shutdown(conn);
+                return;
+            }
+            if (header_size > input.size() - offset - 4)
+            {
+                break;
+            }
+            mprpc::RpcHeader header;
+            if (!header.ParseFromArray(input.data() + offset + 4, header_size))
+            {
+                // 后面的数据已经无法分帧，断开连接，recv结束后释放
+                LOG_ERR("rpc header parse error! header_size:%u", header_size);
+                Shutdown(conn);
+                return;
+            }
+            size_t frame_size = 4 + static_cast<size_t>(header_size) + header.arg_size();
+            if (frame_size > m_maxFrameBytes)
+            {
+                LOG_ERR("rpc frame too large! frame_size:%lu peer:%s", frame_size, conn->Peer().c_str());
+                Shutdown(conn);
+                return;
+            }
+            if (input.size() - offset < frame_size)
+            {
+                break;
+            }
+            m_callback(conn, input.data() + offset, frame_size);
+            offset += frame_size;
+        }
+        input.erase(0, offset);
+    }
+
+    // 关闭读写方向让recv结束，之后释放连接
+    void Shutdown(const std::shared_ptr<Connection> &conn)
+    {
+        conn->input.clear();
+        shutdown(conn->fd, SHUT_RDWR);
+    }
+
+    void OnSend(int fd, int res)
+    {
+        auto it = m_conns.find(fd);
+        if (it == m_conns.end())
+        {
+            return;
+        }
+        std::shared_ptr<Connection> conn = it->second;
+        if (res < 0)
+        {
+            // 发送失败，关闭读方向让recv结束，之后释放连接
+            conn->send_in_flight = false;
+            conn->sending.clear();
+            conn->MarkClosed();
+            shutdown(conn->fd, SHUT_RDWR);
+            MaybeRelease(conn);
+            return;
+        }
+        conn->sent += res;
+        if (conn->sent < conn->sending.size())
+        {
+            ArmSend(conn.get());
+            return;
+        }
+        conn->sending.clear();
+        conn->send_in_flight = false;
+        StartSend(conn.get());
+        MaybeRelease(conn);
+    }
+
+    RpcUring m_ring;
+    int m_listenFd;
+    int m_wakeFd;
+    uint64_t m_wakeValue;
+    size_t m_maxFrameBytes;
+    RpcFrameCallback m_callback;
+    std::atomic<bool> m_stopped;
+    std::atomic<int> m_connections;
+    std::thread m_thread;
+    std::thread::id m_threadId;
+    std::unordered_map<int, std::shared_ptr<Connection>> m_conns;
+    std::mutex m_flushMutex;
+    std::vector<std::shared_ptr<Connection>> m_flushQueue;
+};
+
+bool RpcUringServer::Connection::Send(uint64_t request_id, mprpc::RpcStatus status, const std::string &error_text,
+                                      const google::protobuf::Message *body)
+{
+    mprpc::RpcResponseHeader header;
+    uint32_t len = PrepareFrame(&header, request_id, status, error_text, body);
+    {
+        // 响应直接序列化到待发送缓冲的末尾，同一轮完成的响应合并成一次发送
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed)
+        {
+            return false;
+        }
+        size_t old_size = m_output.size();
+        m_output.resize(old_size + len);
+        WriteFrame(&m_output[old_size], header, body);
+        if (m_flushQueued)
+        {
+            return true;
+        }
+        m_flushQueued = true;
+    }
+    m_worker->QueueFlush(shared_from_this());
+    return true;
+}
+
+bool RpcUringServer::Connection::SendFrame(const std::string &frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed)
+        {
+            return false;
+        }
+        m_output.append(frame);
+        if (m_flushQueued)
+        {
+            return true;
+        }
+        m_flushQueued = true;
+    }
+    m_worker->QueueFlush(shared_from_this());
+    return true;
+}
+
+RpcUringServer::RpcUringServer()
+{
+}
+
+RpcUringServer::~RpcUringServer()
+{
+    Stop();
+}
+
+static int ListenReusePort(const std::string &ip, uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+    {
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = inet_addr(ip.c_str());
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == -1 || listen(fd, SOMAXCONN) == -1)
+    {
+        LOG_ERR("listen on %s:%d error! errno:%d", ip.c_str(), port, errno);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool RpcUringServer::Start(const RpcFrameCallback &callback)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    std::string threads = config.Load("rpc_io_threads");
+    return Start(config.Load("rpcserverip"), atoi(config.Load("rpcserverport").c_str()),
+                 threads.empty() ? 4 : atoi(threads.c_str()), callback);
+}
+
+bool RpcUringServer::Start(const std::string &ip, uint16_t port, int threads, const RpcFrameCallback &callback)
+{
+    MprpcConfig &config = MprpcApplication::GetConfig();
+    int entries = atoi(config.Load("rpc_uring_entries").c_str());
+    int buffers = atoi(config.Load("rpc_uring_buffers").c_str());
+    int buffer_kb = atoi(config.Load("rpc_uring_buffer_kb").c_str());
+    entries = entries > 0 ? entries : 4096;
+    buffers = buffers > 0 && (buffers & (buffers - 1)) == 0 ? buffers : 1024;
+    buffer_kb = buffer_kb > 0 ? buffer_kb : 16;
+    // 和muduo引擎相同的请求帧大小上限，帧长度作为uint32_t交给回调
+    std::string max_frame_str = config.Load("rpc_max_frame_bytes");
+    size_t max_frame_bytes = max_frame_str.empty() ? 64 * 1024 * 1024 : atol(max_frame_str.c_str());
+    max_frame_bytes = std::min<size_t>(max_frame_bytes, UINT32_MAX);
+
+    for (int i = 0; i < (threads > 0 ? threads : 1); i++)
+    {
+        int listen_fd = ListenReusePort(ip, port);
+        if (listen_fd == -1)
+        {
+            Stop();
+            return false;
+        }
+        m_workers.emplace_back(new Worker(listen_fd, max_frame_bytes, callback));
+        if (!m_workers.back()->Start(entries, buffers, buffer_kb * 1024))
+        {
+            LOG_ERR("io_uring engine is not available on this kernel");
+            Stop();
+            return false;
+        }
+    }
+    LOG_INFO("io_uring engine listening on %s:%d with %lu threads", ip.c_str(), port, m_workers.size());
+    return true;
+}
+
+void RpcUringServer::Stop()
+{
+    for (auto &worker : m_workers)
+    {
+        worker->Stop();
+    }
+    m_workers.clear();
+}
+
+int RpcUringServer::Connections() const
+{
+    int connections = 0;
+    for (auto &worker : m_workers)
+    {
+        connections += worker->Connections();
+    }
+    return connections;
+}
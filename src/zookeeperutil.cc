@@ -64,11 +64,12 @@ void ZkClient::Start() {
     }
 }
 
-void ZkClient::Create(const char *path, const char *data, int datalen, int state) {
+std::string ZkClient::Create(const char *path, const char *data, int datalen, int state) {
     // 异步上下文
     struct Context {
         sem_t sem;
         int rc = ZOK;
+        std::string created_path;
     } context;
     sem_init(&context.sem, 0, 0);
     
@@ -78,6 +79,9 @@ void ZkClient::Create(const char *path, const char *data, int datalen, int state
                [](int rc, const char* value, const void* data) {
                    Context* ctx = (Context*)data;
                    ctx->rc = rc;
+                   if (rc == ZOK && value) {
+                       ctx->created_path = value;
+                   }
                    sem_post(&ctx->sem);
                }, 
                &context);
@@ -88,10 +92,58 @@ void ZkClient::Create(const char *path, const char *data, int datalen, int state
     if (context.rc != ZOK) {
         LOG_ERR("Failed to create znode %s: %s", path, zerror(context.rc));
     } else {
-        LOG_INFO("Created znode %s", path);
+        LOG_INFO("Created znode %s", context.created_path.c_str());
     }
     
     sem_destroy(&context.sem);
+    return context.created_path;
+}
+
+bool ZkClient::Delete(const char *path) {
+    // 等待超时后回调仍可能到来，上下文放在堆上，由调用方和回调共同持有
+    struct Context {
+        sem_t sem;
+        int rc = ZOK;
+        Context() { sem_init(&sem, 0, 0); }
+        ~Context() { sem_destroy(&sem); }
+    };
+    auto context = std::make_shared<Context>();
+    auto holder = new std::shared_ptr<Context>(context);
+
+    // version为-1表示不校验节点版本
+    int rc = zoo_adelete(m_zhandle, path, -1,
+               [](int rc, const void *data) {
+                   auto holder = (std::shared_ptr<Context>*)data;
+                   (*holder)->rc = rc;
+                   sem_post(&(*holder)->sem);
+                   delete holder;
+               },
+               holder);
+    if (rc != ZOK) {
+        // 请求没有发出去，回调不会被调用
+        delete holder;
+        LOG_ERR("Failed to delete znode %s: %s", path, zerror(rc));
+        return false;
+    }
+
+    // 最多等5秒，会话断开时不会一直阻塞退出流程
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += 5;
+    while (sem_timedwait(&context->sem, &ts) == -1) {
+        if (errno == EINTR) {
+            continue;
+        }
+        LOG_ERR("Timed out deleting znode %s", path);
+        return false;
+    }
+
+    if (context->rc != ZOK && context->rc != ZNONODE) {
+        LOG_ERR("Failed to delete znode %s: %s", path, zerror(context->rc));
+        return false;
+    }
+    LOG_INFO("Deleted znode %s", path);
+    return true;
 }
 
 bool ZkClient::Exists(const char* path) {